@@ -1,68 +1,98 @@
-#######################################################################################################################
-## BoundingBox.py
-#######################################################################################################################
-##
-## Representation of a bounding box
-## Always a rectangular representation based on min and max values for the three main axis
-##
-## Part of MCNPX Visualizer
-## (c) Nick Michiels for SCK-CEN Mol (2011)
-#######################################################################################################################
-
-import povray
-
-
-class BoundingBox:
-
-    def __init__(self, minX=0, minY=0, minZ=0, maxX=0, maxY=0, maxZ=0, isSphere = False):
-        self.minX = minX
-        self.minY = minY
-        self.minZ = minZ
-        self.maxX = maxX
-        self.maxY = maxY
-        self.maxZ = maxZ
-        self.isSphere = isSphere    # in the future also possible to have a spherical bounding box
-        
-        self.exists = 0             # bool to see if the bounding box exists (good for compound bounded boxes)
-
-    def __repr__(self):
-        return "BoundingBox()"
-    def __str__(self):
-        return "BoundingBox(" + str(self.minX) + "," + str(self.minY) + "," + str(self.minZ) + " - " + str(self.maxX) + "," + str(self.maxY) + "," + str(self.maxZ) + ")"
-    
-    # ==> clone(bb)
-    # Clone the instance information of bb in the current instance
-    #------------------------------------------------------------------------------------------------------------------
-    def clone(self, bb):
-        self.minX = bb.minX
-        self.minY = bb.minY
-        self.minZ = bb.minZ
-        self.maxX = bb.maxX
-        self.maxY = bb.maxY
-        self.maxZ = bb.maxZ
-        self.isSphere = bb.isSphere
-        self.exists = bb.exists
-    
-    # ==> append(bb)
-    # Append the current bounding box with the information out of the bb instance
-    #------------------------------------------------------------------------------------------------------------------
-    def append(self, bb):
-        self.minX = min(self.minX,bb.minX)
-        self.minY = min(self.minY,bb.minY)
-        self.minZ = min(self.minZ,bb.minZ)
-        self.maxX = max(self.maxX,bb.maxX)
-        self.maxY = max(self.maxY,bb.maxY)
-        self.maxZ = max(self.maxZ,bb.maxZ)
-        if (self.isSphere):
-            self.isSphere = False
-    
-    # ==> buildPOVRay()
-    # Build the instance to a pov ray object
-    #------------------------------------------------------------------------------------------------------------------
-    def buildPOVRay(self):
-        if (not self.isSphere):
-            return povray.Box(povray.Vector(self.minX,self.minY,self.minZ), povray.Vector(self.maxX,self.maxY,self.maxZ))
-        if (self.isSphere):
-            return povray.Sphere(povray.Vector( self.minX + (self.maxX - self.minX)/2.0, self.minY + (self.maxY - self.minY)/2.0, self.minZ + (self.maxZ - self.minZ)/2.0), (self.maxZ - self.minZ)/2.0) 
-        return 0
+#######################################################################################################################
+## BoundingBox.py
+#######################################################################################################################
+##
+## Representation of a bounding box
+## Always a rectangular representation based on min and max values for the three main axis
+##
+## Part of MCNPX Visualizer
+## (c) Nick Michiels for SCK-CEN Mol (2011)
+#######################################################################################################################
+
+import povray
+
+
+class BoundingBox:
+
+    def __init__(self, minX=0, minY=0, minZ=0, maxX=0, maxY=0, maxZ=0, isSphere = False):
+        self.minX = minX
+        self.minY = minY
+        self.minZ = minZ
+        self.maxX = maxX
+        self.maxY = maxY
+        self.maxZ = maxZ
+        self.isSphere = isSphere    # in the future also possible to have a spherical bounding box
+        
+        self.exists = 0             # bool to see if the bounding box exists (good for compound bounded boxes)
+
+    def __repr__(self):
+        return "BoundingBox()"
+    def __str__(self):
+        return "BoundingBox(" + str(self.minX) + "," + str(self.minY) + "," + str(self.minZ) + " - " + str(self.maxX) + "," + str(self.maxY) + "," + str(self.maxZ) + ")"
+    
+    # ==> clone(bb)
+    # Clone the instance information of bb in the current instance
+    #------------------------------------------------------------------------------------------------------------------
+    def clone(self, bb):
+        self.minX = bb.minX
+        self.minY = bb.minY
+        self.minZ = bb.minZ
+        self.maxX = bb.maxX
+        self.maxY = bb.maxY
+        self.maxZ = bb.maxZ
+        self.isSphere = bb.isSphere
+        self.exists = bb.exists
+    
+    # ==> append(bb)
+    # Append the current bounding box with the information out of the bb instance
+    #------------------------------------------------------------------------------------------------------------------
+    def append(self, bb):
+        self.minX = min(self.minX,bb.minX)
+        self.minY = min(self.minY,bb.minY)
+        self.minZ = min(self.minZ,bb.minZ)
+        self.maxX = max(self.maxX,bb.maxX)
+        self.maxY = max(self.maxY,bb.maxY)
+        self.maxZ = max(self.maxZ,bb.maxZ)
+        if (self.isSphere):
+            self.isSphere = False
+    
+    # ==> intersect(bb)
+    # Shrink the current bounding box to the part that lies in the bb instance as well
+    #------------------------------------------------------------------------------------------------------------------
+    def intersect(self, bb):
+        self.minX = max(self.minX,bb.minX)
+        self.minY = max(self.minY,bb.minY)
+        self.minZ = max(self.minZ,bb.minZ)
+        self.maxX = min(self.maxX,bb.maxX)
+        self.maxY = min(self.maxY,bb.maxY)
+        self.maxZ = min(self.maxZ,bb.maxZ)
+        if (self.isSphere):
+            self.isSphere = False
+    
+    # ==> translate(translate)
+    # Move the current bounding box over the vector translate ([x, y, z])
+    #------------------------------------------------------------------------------------------------------------------
+    def translate(self, translate):
+        self.minX = self.minX + translate[0]
+        self.minY = self.minY + translate[1]
+        self.minZ = self.minZ + translate[2]
+        self.maxX = self.maxX + translate[0]
+        self.maxY = self.maxY + translate[1]
+        self.maxZ = self.maxZ + translate[2]
+    
+    # ==> isEmpty()
+    # Returns if the bounding box has no volume (i.e. the intersection of two boxes that doesn't overlap)
+    #------------------------------------------------------------------------------------------------------------------
+    def isEmpty(self):
+        return (self.minX > self.maxX or self.minY > self.maxY or self.minZ > self.maxZ)
+    
+    # ==> buildPOVRay()
+    # Build the instance to a pov ray object
+    #------------------------------------------------------------------------------------------------------------------
+    def buildPOVRay(self):
+        if (not self.isSphere):
+            return povray.Box(povray.Vector(self.minX,self.minY,self.minZ), povray.Vector(self.maxX,self.maxY,self.maxZ))
+        if (self.isSphere):
+            return povray.Sphere(povray.Vector( self.minX + (self.maxX - self.minX)/2.0, self.minY + (self.maxY - self.minY)/2.0, self.minZ + (self.maxZ - self.minZ)/2.0), (self.maxZ - self.minZ)/2.0) 
+        return 0
                 
\ No newline at end of file
@@ -0,0 +1,222 @@
+#######################################################################################################################
+## IntervalBounds.py
+#######################################################################################################################
+##
+## Axis aligned bounds of the inside of planes and quadrics by interval arithmetic
+## A quadric is a list [A, B, C, D, E, F, G, H, J, K] of the mcnpx GQ surface
+##	Ax^2 + By^2 + Cz^2 + Dxy + Eyz + Fzx + Gx + Hy + Jz + K
+## of which the inside (negative sense) is the part where it is negative (a plane has A = ... = F = 0)
+## A box is a list of three intervals [[minX, maxX], [minY, maxY], [minZ, maxZ]] that can be infinite
+##
+## Part of MCNPX Visualizer
+## (c) Nick Michiels for SCK-CEN Mol (2011)
+#######################################################################################################################
+
+import math
+
+INF = float('inf')
+
+# index of the coefficients of the quadric per axis (x, y, z)
+SQUARE = [0, 1, 2]						# A, B, C
+LINEAR = [6, 7, 8]						# G, H, J
+CROSS = {(0, 1): 3, (1, 2): 4, (0, 2): 5}	# D (xy), E (yz), F (zx)
+
+class IntervalBounds:
+
+	# ==> infiniteBox()
+	# Returns a box without bounds
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def infiniteBox():
+		return [[-INF, INF], [-INF, INF], [-INF, INF]]
+
+	# ==> isFinite(box)
+	# Returns if all the bounds of the box are finite
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def isFinite(box):
+		for interval in box:
+			if (interval[0] == -INF or interval[1] == INF):
+				return False
+		return True
+
+	# ==> intersect(box1, box2)
+	# Returns the overlap of two boxes or None if they don't overlap
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def intersect(box1, box2):
+		box = []
+		for n in range(0,3):
+			interval = [max(box1[n][0], box2[n][0]), min(box1[n][1], box2[n][1])]
+			if (interval[0] > interval[1]):
+				return None
+			box.append(interval)
+		return box
+
+	# ==> hull(box1, box2)
+	# Returns the box that contains both boxes
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def hull(box1, box2):
+		return [[min(box1[n][0], box2[n][0]), max(box1[n][1], box2[n][1])] for n in range(0,3)]
+
+	# ==> scale(factor, interval)
+	# Interval arithmetic: factor * [a, b] (a zero factor gives zero, also for an infinite interval)
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def scale(factor, interval):
+		if (factor == 0):
+			return [0.0, 0.0]
+		if (factor > 0):
+			return [factor*interval[0], factor*interval[1]]
+		return [factor*interval[1], factor*interval[0]]
+
+	# ==> multiply(interval1, interval2)
+	# Interval arithmetic: [a, b] * [c, d]
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def multiply(interval1, interval2):
+		products = []
+		for a in interval1:
+			for b in interval2:
+				if (a == 0 or b == 0):
+					products.append(0.0)
+				else:
+					products.append(a*b)
+		return [min(products), max(products)]
+
+	# ==> quadratic(a, b, interval)
+	# Returns the exact range of a u^2 + b u for u in the interval (not the wider a [u]^2 + b [u])
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def quadratic(a, b, interval):
+		values = [IntervalBounds.evaluate(a, b, u) for u in interval]
+		if (a != 0 and interval[0] < -b/(2*a) < interval[1]):
+			values.append(IntervalBounds.evaluate(a, b, -b/(2*a)))
+		return [min(values), max(values)]
+
+	# ==> evaluate(a, b, u)
+	# Returns a u^2 + b u, also for an infinite u
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def evaluate(a, b, u):
+		if (u == INF or u == -INF):
+			if (a != 0):
+				return math.copysign(INF, a)
+			if (b != 0):
+				return math.copysign(INF, b*u)
+			return 0.0
+		return a*u*u + b*u
+
+	# ==> add(interval1, interval2)
+	# Interval arithmetic: [a, b] + [c, d]
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def add(interval1, interval2):
+		return [interval1[0] + interval2[0], interval1[1] + interval2[1]]
+
+	# ==> translateQuadric(quadric, translation)
+	# Returns the quadric moved over translation ([x, y, z]): Q(p - t)
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def translateQuadric(quadric, translation):
+		q = list(quadric)
+		t = translation
+		# gradient of the quadratic part in t
+		gradient = [2*quadric[0]*t[0] + quadric[3]*t[1] + quadric[5]*t[2],
+					2*quadric[1]*t[1] + quadric[3]*t[0] + quadric[4]*t[2],
+					2*quadric[2]*t[2] + quadric[4]*t[1] + quadric[5]*t[0]]
+		quadratic = (quadric[0]*t[0]*t[0] + quadric[1]*t[1]*t[1] + quadric[2]*t[2]*t[2]
+					+ quadric[3]*t[0]*t[1] + quadric[4]*t[1]*t[2] + quadric[5]*t[2]*t[0])
+		for n in range(0,3):
+			q[LINEAR[n]] = quadric[LINEAR[n]] - gradient[n]
+		q[9] = quadric[9] + quadratic - quadric[6]*t[0] - quadric[7]*t[1] - quadric[8]*t[2]
+		return q
+
+	# ==> negateQuadric(quadric)
+	# Returns the quadric of the outside (positive sense) of a surface
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def negateQuadric(quadric):
+		return [-c for c in quadric]
+
+	# ==> contract(box, quadric)
+	# Shrink every axis of the box to the part in which the quadric can be negative, given the other axes
+	# For axis x the quadric is a x^2 + b x + c with a = A, b = Dy + Fz + G and c = the rest (intervals over the box)
+	# Returns the new box or None if the quadric is positive in the entire box
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def contract(box, quadric):
+		box = [list(interval) for interval in box]
+		for n in range(0,3):
+			others = [m for m in range(0,3) if m != n]
+			a = quadric[SQUARE[n]]
+			b = [quadric[LINEAR[n]], quadric[LINEAR[n]]]
+			c = [quadric[9], quadric[9]]
+			for m in others:
+				b = IntervalBounds.add(b, IntervalBounds.scale(quadric[CROSS[tuple(sorted((n, m)))]], box[m]))
+				c = IntervalBounds.add(c, IntervalBounds.quadratic(quadric[SQUARE[m]], quadric[LINEAR[m]], box[m]))
+			c = IntervalBounds.add(c, IntervalBounds.scale(quadric[CROSS[tuple(others)]], IntervalBounds.multiply(box[others[0]], box[others[1]])))
+			interval = IntervalBounds.solve(a, b, c[0])
+			if (interval == None):
+				return None
+			box[n] = [max(box[n][0], interval[0]), min(box[n][1], interval[1])]
+			if (box[n][0] > box[n][1]):
+				return None
+		return box
+
+	# ==> solve(a, b, c)
+	# Returns the interval of u in which a u^2 + b u + c can be negative for some b in the interval b and the
+	# minimal value c (no bounds if the interval can't be found) or None if there is no such u
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def solve(a, b, c):
+		if (c == -INF or b[0] == -INF or b[1] == INF or a < 0):
+			return [-INF, INF]
+		if (a == 0):
+			# b u + c < 0
+			if (b[0] > 0):
+				return [-INF, max(-c/b[0], -c/b[1])]
+			if (b[1] < 0):
+				return [min(-c/b[0], -c/b[1]), INF]
+			return [-INF, INF]
+		# u >= 0: a u^2 + b[0] u + c < 0 and u <= 0: a u^2 + b[1] u + c < 0
+		positive = IntervalBounds.roots(a, b[0], c)
+		if (positive and positive[1] < 0):
+			positive = None
+		negative = IntervalBounds.roots(a, b[1], c)
+		if (negative and negative[0] > 0):
+			negative = None
+		if (not positive and not negative):
+			return None
+		if (not positive):
+			return [negative[0], min(negative[1], 0.0)]
+		if (not negative):
+			return [max(positive[0], 0.0), positive[1]]
+		return [negative[0], positive[1]]
+
+	# ==> roots(a, b, c)
+	# Returns the roots [u1, u2] (u1 <= u2) of a u^2 + b u + c with a > 0 or None if there are no roots
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def roots(a, b, c):
+		discriminant = b*b - 4*a*c
+		if (discriminant < 0):
+			return None
+		return [(-b - math.sqrt(discriminant))/(2*a), (-b + math.sqrt(discriminant))/(2*a)]
+
+	# ==> contractAll(box, quadrics)
+	# Shrink the box by all the quadrics of an intersection until it doesn't change anymore (limited number of passes)
+	# Returns the new box or None if the intersection is empty
+	#------------------------------------------------------------------------------------------------------------------
+	@staticmethod
+	def contractAll(box, quadrics):
+		for i in range(0,8):
+			previous = box
+			for quadric in quadrics:
+				box = IntervalBounds.contract(box, quadric)
+				if (box == None):
+					return None
+			if (box == previous):
+				break
+		return box
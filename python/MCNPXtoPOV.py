@@ -1,241 +1,308 @@
-#######################################################################################################################
-## MCNPXtoPOV.py
-#######################################################################################################################
-##
-## Main function for parsing/building the MCNPX file to a Pov Ray file
-## First pass: parses all the cell, surface and materials cards to a proper Python representations
-## Second pass: builds all the cells available to a Pov Ray representation
-##
-##	arg1: Input MCNPX file
-##	arg2: Output Pov Ray file
-##	arg3: Optional input color map to be used in the building (when no color map given, it uses the standard colors)
-##
-## Part of MCNPX Visualizer
-## (c) Nick Michiels for SCK-CEN Mol (2011)
-#######################################################################################################################
-
-#######################################################################################################################
-## USEFULL LINKS
-#######################################################################################################################
-##
-## POV-RAY
-## -----------------------------------
-## PRISMS:	http://www.povray.org/documentation/view/3.6.2/62/
-## QUADRICS:	http://www.povray.org/documentation/view/3.6.0/299 (for infinite object description)
-## BOX:		http://www.povray.org/documentation/view/3.6.1/276/
-## SPHERE:	http://www.povray.org/documentation/view/3.6.1/283/
-## CYLINDER:	http://www.povray.org/documentation/view/3.6.1/278/
-## FRAMEWORK FOR SOLVING EQUATIONS: http://code.google.com/p/sympy/
-#######################################################################################################################
-
-import sys
-import getopt
-
-import povray
-import MCNPXParser
-
-# main function
-# inputs a mcnpx-file (inputFile)
-# outputs the pov ray builded scene
-# optional (but recommended): input color map (link every material to a color)
-def parse(inputFile, outputFile, colorMapFile):
-	
-############################&####
-#  OPTIONS
-################################
-
-	buildVoid = True
-
-# END OPTIONS
-
-################################
-#  INITIALISE
-################################	
-	
-	parser = MCNPXParser.MCNPXParser(inputFile, outputFile, colorMapFile)
-	parser.preProcess()	# remove unnecessary data out of the mcnpx file (i.e. comments)
-	
-	file=povray.File(outputFile,"colors.inc","stones.inc")
-	fileImp=povray.File(outputFile+"_imp0.pov");
-	
-################################
-#  PARSING
-################################
-
-	print "START PARSING", inputFile, " to ", outputFile
-	
-	print "\nPARSING DATA CARDS"
-	parser.parseDataCards()
-	print "\t" + str(len(parser.dataCards)) + " DATA CARDS PARSED"
-	
-	print "\nPARSING SURFACE CARDS"
-	parser.parseSurfaces()
-	print "\t" + str(len(parser.surfaceCards)) + " SURFACE CARDS PARSED"
-
-	print "\nPARSING CELL CARDS"
-	parser.parseCells()
-	print "\t" + str(len(parser.cellCards)) + " SURFACE CARDS PARSED"
-	
-	print "\t"  + str(len(parser.universes)) + " Universes Found:",
-	for uni in parser.universes:
-		print str(uni) + "",
-	print ""
-
-################################
-#  BUILDING
-################################
-
-	print "\nBUILDING CELL CARDS"
-	
-	# write a standard macro for drawing universes in Pov-Ray which can be used for every sort of universe
-	file.writeln("//Macro's for drawing")
-	file.writeln("#macro Draw_Universe(universe, pos, rot)")
-	file.indent()
-	file.writeln("object {")
-	file.indent()
-	file.writeln("universe")
-	file.writeln("#if (pos != 0)")
-	file.indent()
-	file.writeln("translate pos")
-	file.dedent()
-	file.writeln("#end")
-	file.writeln("#if (rot != 0)")
-	file.indent()
-	file.writeln("rotate rot")
-	file.dedent()
-	file.writeln("#end")
-	file.dedent()	
-	file.writeln("}")
-	file.dedent()
-	file.writeln("#end")
-
-	items = [] # this list will contain all the builded cell cards
-	imp0Items = []
-	for i, card in  (enumerate(parser.cellCards)): # use enumerate to sort the cell cards to be builded
-		cellCard = parser.getCellCard(card)
-		if (cellCard and cellCard.params.has_key("IMP")):
-			# cellcard with imp=0 doesn't need to be builded with colors and to the main pov-ray output file
-			# it will be build without colors and a smaller scale to the fileImp output
-			# this will be used to limit the rendered scene to the imp=1 space
-			if (cellCard.params["IMP"] == "n=0" or cellCard.params["IMP"] == "N=0"):
-				povItem = parser.buildCell(cellNumber = card, parent = 0, depth = 0,  buildVoid = buildVoid, useColor=False, scale=0.99999)
-				if povItem:
-					imp0Items.append(povItem)
-				continue
-			else:
-				povItem = parser.buildCell(cellNumber = card, parent = 0, depth = 0,  buildVoid = buildVoid, useColor=True)
-				if (povItem):
-					items.append(["//" + parser.getGeometryOfCellCard(card), povItem])
-		elif (cellCard):
-			povItem = parser.buildCell(cellNumber = card, parent = 0, depth = 0,  buildVoid = buildVoid, useColor=True)
-			if (povItem):
-				items.append(["//" + parser.getGeometryOfCellCard(card), povItem])
-	
-	imp0Cells = parser.getImpZeroCellCard()
-	imp0Items= []
-	if (imp0Cells):
-		for cell in imp0Cells:
-			povItem = parser.buildCell(cellNumber = cell.number, parent = 0, depth = 0,  buildVoid = buildVoid, useColor=False, scale=0.99999)
-			if povItem:
-				imp0Items.append(povItem)
-		if (len(imp0Items) == 1):
-			fileImp.write(imp0Items[0])
-		elif (len(imp0Items) > 1):
-			fileImp.writeln("union {")
-			fileImp.indent()
-			for item in imp0Items:	
-				fileImp.write(item)
-			fileImp.dedent()
-			fileImp.writeln(" }")
-	
-				
-			
-	# write the declared macro's for the universes to the povray file
-	# it needs a correct sorting so every sub macro that is used in a universe is known
-	# every universe is defined with a certain depth (depth first added to the pov ray file)
-	file.writeln("// DECLARED UNIVERSES")
-	file.writeln("// ***************************************************************************")
-	sortedUniverses = sorted(parser.declaredUniverses, key=lambda depth: depth[0], reverse=True)
-	for i in range(0, len(sortedUniverses)): 
-		file.writeln("// UNIVERSE " + parser.declaredUniverses[i][1])
-		file.write(parser.declaredUniverses[i][2])
-		
-	# After printing all the macro's, the cell cards are added to the file
-	file.writeln("// All cells are combined in a big union")
-	file.writeln("union {")
-	file.indent()	
-	for i in range(0,len(items)):
-		file.writeln(items[i][0])
-		file.write(items[i][1])
-	file.dedent()
-	file.writeln("}")
-	file.writeln("")
-
-	# print surface cards to the povray output as debug information
-	file.writeln("// LIST OF ALL SURFACES:")
-	for card in parser.surfaceCards:
-		surfaceCard = parser.surfaceCards[card]
-		file.writeln("//" + surfaceCard.getSurfaceLine())
-
-	print "\t" + str(len(parser.cellCards)) + " CELL CARDS BUILDED"
-	print "\nEND BUILDING CELL CARDS"
-
-	print "\nMCNPX to POV RAY COMPLETED"
-	print "TITLE MCNPX: " + parser.title
-
-	#oStrippedFile = open(inputFile + "stripped.txt", 'w')
-	#for line in parser.cellBlock:
-	#	oStrippedFile.writelines(line + '\n')
-	#oStrippedFile.writelines('\n')
-	#for line in parser.surfaceBlock:
-	#	oStrippedFile.write(line + '\n')
-
-	parser.close()
-
-
-def initialize():
-	
-	#---------------------------------------------------------
-	# TEMP: hard coded arguments
-	#---------------------------------------------------------
-	#parse("mcnpx/if4", "mcnpx/if4Out.pov")
-	#parse("mcnpx/if4b", "mcnpx/if4bOut.pov")
-	#parse("mcnpx/if5", "mcnpx/if5Out.pov")
-	#parse("mcnpx/geom5b", "mcnpx/geom5bOut.pov")
-	#parse("mcnpx/geom5a", "mcnpx/geom5aOut.pov")
-	#parse("mcnpx/hex.txt", "mcnpx/hexOut.pov")
-	#parse("mcnpx/big.txt", "mcnpx/bigOut.pov")
-	#parse("mcnpx/g3.txt", "mcnpx/g3Out.pov", "mcnpx/g3_colorMap")
-	#parse("mcnpx/refcore_c", "mcnpx/refcore_cOut.pov")
-	#parse("mcnpx/80.0", "mcnpx/80.0Out.pov")
-	#parse("mcnpx/graph.txt", "mcnpx/graphOut.pov")
-	#parse("mcnpx/graph.txt", "mcnpx/graphOut.pov")
-	#parse("mcnpx/graphb.txt", "mcnpx/grapbbOut.pov")
-	#parse("mcnpx/graphc.txt", "mcnpx/graphcOut.pov")
-	
-	#---------------------------------------------------------
-	# TEMP: TEST FILES
-	#---------------------------------------------------------
-	#parse("mcnpx/testNesting.txt", "mcnpx/testNestingOut.pov")
-	#parse("mcnpx/testRotation.txt", "mcnpx/testRotationOut.pov")
-	
-	
-	try:
-		opts, args = getopt.getopt(sys.argv[1:], "h", ["help"])
-	except getopt.error, msg:
-		print msg
-		print "for help use --help"
-		sys.exit(2)
-	
-
-	
-	if len(args) != 3:
-		print "ERROR (MCNPXtoPOV.py): not enough arguments"
-		return 1
-	
-	parse(args[0], args[1], args[2])
-	
-
-if __name__ == "__main__":
-	initialize()
-
+#######################################################################################################################
+## MCNPXtoPOV.py
+#######################################################################################################################
+##
+## Main function for parsing/building the MCNPX file to a Pov Ray file
+## First pass: parses all the cell, surface and materials cards to a proper Python representations
+## Second pass: builds all the cells available to a Pov Ray representation
+##
+##	arg1: Input MCNPX file
+##	arg2: Output Pov Ray file
+##	arg3: Optional input color map to be used in the building (when no color map given, it uses the standard colors)
+##	--low-priority: build at a low process priority (i.e. a speculative build in the background of the GUI)
+##
+## Part of MCNPX Visualizer
+## (c) Nick Michiels for SCK-CEN Mol (2011)
+#######################################################################################################################
+
+#######################################################################################################################
+## USEFULL LINKS
+#######################################################################################################################
+##
+## POV-RAY
+## -----------------------------------
+## PRISMS:	http://www.povray.org/documentation/view/3.6.2/62/
+## QUADRICS:	http://www.povray.org/documentation/view/3.6.0/299 (for infinite object description)
+## BOX:		http://www.povray.org/documentation/view/3.6.1/276/
+## SPHERE:	http://www.povray.org/documentation/view/3.6.1/283/
+## CYLINDER:	http://www.povray.org/documentation/view/3.6.1/278/
+## FRAMEWORK FOR SOLVING EQUATIONS: http://code.google.com/p/sympy/
+#######################################################################################################################
+
+import os
+import sys
+import getopt
+
+import povray
+import MCNPXParser
+
+# main function
+# inputs a mcnpx-file (inputFile)
+# outputs the pov ray builded scene
+# optional (but recommended): input color map (link every material to a color)
+def parse(inputFile, outputFile, colorMapFile):
+	
+############################&####
+#  OPTIONS
+################################
+
+	buildVoid = True
+	workers = 0		# number of processes that build the cells and universes (0 = number of cores)
+
+# END OPTIONS
+
+################################
+#  INITIALISE
+################################	
+	
+	parser = MCNPXParser.MCNPXParser(inputFile, outputFile, colorMapFile)
+	parser.preProcess()	# remove unnecessary data out of the mcnpx file (i.e. comments)
+	
+	# the textures of the materials are written to a separate include, so the colors can change without parsing again
+	materialsInclude = parser.writeMaterialTextures(outputFile + "_materials.inc")
+	fileImp=povray.File(outputFile+"_imp0.pov");
+	
+################################
+#  PARSING
+################################
+
+	print "START PARSING", inputFile, " to ", outputFile
+	
+	print "\nPARSING DATA CARDS"
+	parser.parseDataCards()
+	print "\t" + str(len(parser.dataCards)) + " DATA CARDS PARSED"
+	
+	print "\nPARSING SURFACE CARDS"
+	parser.parseSurfaces()
+	print "\t" + str(len(parser.surfaceCards)) + " SURFACE CARDS PARSED"
+
+	print "\nPARSING CELL CARDS"
+	parser.parseCells()
+	print "\t" + str(len(parser.cellCards)) + " SURFACE CARDS PARSED"
+	
+	print "\t"  + str(len(parser.universes)) + " Universes Found:",
+	for uni in parser.universes:
+		print str(uni) + "",
+	print ""
+	
+	# the visibility switches of the cells and universes are written to a separate include as well
+	switchesInclude = parser.writeVisibilitySwitches(outputFile + "_switches.inc")
+	# and the region that the active section keeps, so pov ray doesn't parse the cells that are cut away
+	sectionInclude = parser.writeSectionVolume(outputFile + "_section.inc")
+	file=povray.File(outputFile,"colors.inc","stones.inc", materialsInclude, switchesInclude, sectionInclude)
+
+################################
+#  BUILDING
+################################
+
+	print "\nBUILDING CELL CARDS"
+	
+	# write a standard macro for drawing universes in Pov-Ray which can be used for every sort of universe
+	file.writeln("//Macro's for drawing")
+	file.writeln("#macro Draw_Universe(universe, pos, rot)")
+	file.indent()
+	file.writeln("object {")
+	file.indent()
+	file.writeln("universe")
+	file.writeln("#if (pos != 0)")
+	file.indent()
+	file.writeln("translate pos")
+	file.dedent()
+	file.writeln("#end")
+	file.writeln("#if (rot != 0)")
+	file.indent()
+	file.writeln("rotate rot")
+	file.dedent()
+	file.writeln("#end")
+	file.dedent()	
+	file.writeln("}")
+	file.dedent()
+	file.writeln("#end")
+
+	cellTasks = [] # [cellNumber, useColor, scale, buildVoid] for every cell card to be builded
+	for i, card in  (enumerate(parser.cellCards)): # use enumerate to sort the cell cards to be builded
+		cellCard = parser.getCellCard(card)
+		if (cellCard and cellCard.params.has_key("IMP")):
+			# cellcard with imp=0 doesn't need to be builded with colors and to the main pov-ray output file
+			# it will be build without colors and a smaller scale to the fileImp output (see below)
+			# this will be used to limit the rendered scene to the imp=1 space
+			if (cellCard.params["IMP"] == "n=0" or cellCard.params["IMP"] == "N=0"):
+				continue
+			else:
+				cellTasks.append([card, True, 1.0, buildVoid])
+		elif (cellCard):
+			cellTasks.append([card, True, 1.0, buildVoid])
+	
+	imp0Cells = parser.getImpZeroCellCard()
+	imp0Tasks = []
+	if (imp0Cells):
+		for cell in imp0Cells:
+			imp0Tasks.append([cell.number, False, 0.99999, buildVoid])
+	
+	# every top level cell and universe is written to its own include in the scene directory of the mcnpx file
+	# the cells whose input didn't change since the previous build are kept as they are and not builded again
+	# (before the workers are started, so they know the declarations of these cells as well)
+	sceneDirectory = os.path.join(os.path.dirname(os.path.abspath(outputFile)), os.path.basename(inputFile) + "_scene")
+	parser.startScene(sceneDirectory)
+	inputHashes = {}
+	buildTasks = []
+	retainedTasks = []
+	for task in cellTasks:
+		inputHashes[task[0]] = parser.getCellInputHash(task)
+		if (parser.retainCell(task[0], inputHashes[task[0]])):
+			retainedTasks.append(task)
+		else:
+			buildTasks.append(task)
+
+	# start the worker processes, the top level cells and the universes of lattices are independent of each other
+	parser.startWorkers(workers)
+	print "\t" + str(parser.workers) + " WORKER PROCESSES"
+	
+	# build everything at once so the pool is used for the imp=0 cells as well
+	# the builded items are returned in task order (the order of the declarations may depend on the workers)
+	# the declarations that are made while building a cell are owned by that cell (see SceneDirectory.writeCell)
+	imp0Items = []
+	for i, povItem in enumerate(parser.buildCells(buildTasks + imp0Tasks)):
+		if (i < len(buildTasks)):
+			writeCell(parser, buildTasks[i][0], inputHashes[buildTasks[i][0]], povItem)
+		elif (povItem):
+			imp0Items.append(povItem)
+	parser.scene.disownDeclarations()
+	
+	# a retained cell that uses declarations which aren't declared anymore (because the cell that owned them has
+	# changed) is builded again as well
+	while (True):
+		missingTasks = [task for task in retainedTasks if parser.scene.getMissingDeclarations(task[0])]
+		if (not missingTasks):
+			break
+		for task in missingTasks:
+			parser.releaseCell(task[0])
+			retainedTasks.remove(task)
+			buildTasks.append(task)
+		for i, povItem in enumerate(parser.buildCells(missingTasks)):
+			writeCell(parser, missingTasks[i][0], inputHashes[missingTasks[i][0]], povItem)
+	
+	if (imp0Cells):
+		if (len(imp0Items) == 1):
+			fileImp.write(imp0Items[0])
+		elif (len(imp0Items) > 1):
+			fileImp.writeln("union {")
+			fileImp.indent()
+			for item in imp0Items:	
+				fileImp.write(item)
+			fileImp.dedent()
+			fileImp.writeln(" }")
+	
+	# include the declared objects, the macro's for the universes and the cells (in a big union) in the povray file
+	# a cell with a known bounding box is only included when it overlaps the section volume
+	sectionConditions = {}
+	for task in cellTasks:
+		bb = parser.getSectionBoxOfCell(task[0])
+		if (bb):
+			sectionConditions[task[0]] = parser.getSectionCondition(bb)
+	parser.scene.finish(file, [task[0] for task in cellTasks], sectionConditions)
+	print "\t" + str(countTopLevelCells(parser, retainedTasks)) + " CELLS UNCHANGED, " + str(countTopLevelCells(parser, buildTasks)) + " CELLS BUILDED, " + str(parser.scene.written) + " INCLUDES WRITTEN TO " + sceneDirectory
+
+	# print surface cards to the povray output as debug information
+	file.writeln("// LIST OF ALL SURFACES:")
+	for card in parser.surfaceCards:
+		surfaceCard = parser.surfaceCards[card]
+		file.writeln("//" + surfaceCard.getSurfaceLine())
+
+	print "\t" + str(len(parser.cellCards)) + " CELL CARDS BUILDED"
+	print "\nCOMPLEMENTS (#n) DECLARED"
+	parser.reportComplements()
+	print "\nEND BUILDING CELL CARDS"
+
+	print "\nMCNPX to POV RAY COMPLETED"
+	print "TITLE MCNPX: " + parser.title
+
+	#oStrippedFile = open(inputFile + "stripped.txt", 'w')
+	#for line in parser.cellBlock:
+	#	oStrippedFile.writelines(line + '\n')
+	#oStrippedFile.writelines('\n')
+	#for line in parser.surfaceBlock:
+	#	oStrippedFile.write(line + '\n')
+
+	parser.close()
+
+
+# write a builded top level cell (with its visibility switch) to its include of the scene directory
+def writeCell(parser, cellNumber, inputHash, povItem):
+	if (povItem):
+		text = "//" + parser.getGeometryOfCellCard(cellNumber) + os.linesep
+		text = text + povray.toString(parser.buildSwitch(parser.getCellSwitch(cellNumber), povItem))
+		parser.scene.writeCell(cellNumber, inputHash, text)
+	else:
+		parser.scene.writeCell(cellNumber, inputHash, 0)
+
+
+# the number of tasks of top level cells (the cells of a universe are only builded as part of the cell they fill)
+def countTopLevelCells(parser, tasks):
+	return len([task for task in tasks if not parser.getCellCard(task[0]).params.has_key('U')])
+
+
+# lower the priority of this process (and of the worker processes that it starts), so the GUI stays responsive
+def lowerPriority():
+	try:
+		if (hasattr(os, "nice")):
+			os.nice(10)
+		else:
+			import ctypes
+			BELOW_NORMAL_PRIORITY_CLASS = 0x4000
+			kernel32 = ctypes.windll.kernel32
+			kernel32.SetPriorityClass(kernel32.GetCurrentProcess(), BELOW_NORMAL_PRIORITY_CLASS)
+	except Exception:
+		print "WARNING (MCNPXtoPOV.py): unable to lower the priority"
+
+
+def initialize():
+	
+	#---------------------------------------------------------
+	# TEMP: hard coded arguments
+	#---------------------------------------------------------
+	#parse("mcnpx/if4", "mcnpx/if4Out.pov")
+	#parse("mcnpx/if4b", "mcnpx/if4bOut.pov")
+	#parse("mcnpx/if5", "mcnpx/if5Out.pov")
+	#parse("mcnpx/geom5b", "mcnpx/geom5bOut.pov")
+	#parse("mcnpx/geom5a", "mcnpx/geom5aOut.pov")
+	#parse("mcnpx/hex.txt", "mcnpx/hexOut.pov")
+	#parse("mcnpx/big.txt", "mcnpx/bigOut.pov")
+	#parse("mcnpx/g3.txt", "mcnpx/g3Out.pov", "mcnpx/g3_colorMap")
+	#parse("mcnpx/refcore_c", "mcnpx/refcore_cOut.pov")
+	#parse("mcnpx/80.0", "mcnpx/80.0Out.pov")
+	#parse("mcnpx/graph.txt", "mcnpx/graphOut.pov")
+	#parse("mcnpx/graph.txt", "mcnpx/graphOut.pov")
+	#parse("mcnpx/graphb.txt", "mcnpx/grapbbOut.pov")
+	#parse("mcnpx/graphc.txt", "mcnpx/graphcOut.pov")
+	
+	#---------------------------------------------------------
+	# TEMP: TEST FILES
+	#---------------------------------------------------------
+	#parse("mcnpx/testNesting.txt", "mcnpx/testNestingOut.pov")
+	#parse("mcnpx/testRotation.txt", "mcnpx/testRotationOut.pov")
+	
+	
+	try:
+		opts, args = getopt.getopt(sys.argv[1:], "h", ["help", "low-priority"])
+	except getopt.error, msg:
+		print msg
+		print "for help use --help"
+		sys.exit(2)
+	
+	for opt, value in opts:
+		if (opt == "--low-priority"):
+			lowerPriority()
+	
+
+	
+	if len(args) != 3:
+		print "ERROR (MCNPXtoPOV.py): not enough arguments"
+		return 1
+	
+	parse(args[0], args[1], args[2])
+	
+
+if __name__ == "__main__":
+	sys.exit(initialize()) # the visualizer decides by the exit code if the parse succeeded
+
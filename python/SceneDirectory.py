@@ -0,0 +1,345 @@
+#######################################################################################################################
+## SceneDirectory.py
+#######################################################################################################################
+##
+## Directory with the builded scene split in include files:
+##      objects.inc:            all declared objects (i.e. shared geometries, parent clips, complements)
+##      universe_<name>.inc:    macro of every declared universe (also lattice elements and rows)
+##      cell_<number>.inc:      every top level cell
+##      manifest:               content hash of every include and the input hash of every top level cell
+##
+## A top level cell whose input (its cell cards, the cards of the universes it contains, ...) didn't change since the
+## previous build is not builded again. Its include and the declarations it made are kept (retained).
+## An include is only written when its content changed, so a partial regeneration only touches the changed files.
+##
+## Part of MCNPX Visualizer
+## (c) Nick Michiels for SCK-CEN Mol (2011)
+#######################################################################################################################
+
+import os
+import re
+import hashlib
+import tempfile
+
+import povray
+
+
+class SceneDirectory:
+
+    def __init__(self, directory, inputHash):
+        self.directory = directory
+        self.inputHash = inputHash          # hash of everything that all cells depend on (surfaces, data cards, ...)
+
+        self.previousCells = {}             # cells of the previous build - format: number -> [input hash, content hash, owned, references]
+        self.previousUniverses = {}         # universes of the previous build - format: name -> [depth, content hash, references]
+        self.previousObjects = {}           # objects of the previous build - format: name -> references
+        self.previousHashes = {}            # content hash of every include of the previous build - format: file -> hash
+
+        self.cells = {}                     # cells of this build - format: number -> [input hash, content hash, owned, references]
+        self.universes = {}                 # universes of this build - format: name -> [depth, content hash, references]
+        self.retainedObjects = {}           # objects of the previous build that are kept - format: name -> references
+        self.retainedOrder = []             # names of the retained objects in the order of objects.inc
+        self.objects = []                   # objects declared in this build - format: [name, references]
+        self.objectNames = {}
+        self.pending = []                   # declarations since the last cell, owned by the next cell - format: [kind, name]
+        self.written = 0                    # number of includes that are written
+
+        if (not os.path.isdir(directory)):
+            os.makedirs(directory)
+        self.readManifest()
+        self.objectSpool = povray.File(tempfile.TemporaryFile(dir=directory))
+
+    def __repr__(self):
+        return "SceneDirectory()"
+    def __str__(self):
+        return "SceneDirectory(" + self.directory + ")"
+
+    # ==> getFileName(name)
+    # Returns the absolute name of a file in the scene directory (forward slashes, because pov ray includes it)
+    #------------------------------------------------------------------------------------------------------------------
+    def getFileName(self, name):
+        return os.path.abspath(os.path.join(self.directory, name)).replace("\\", "/")
+
+    # ==> getMacroName(name)
+    # Returns the name of the macro of a declared universe (universes are declared by number, lattices by name)
+    #------------------------------------------------------------------------------------------------------------------
+    def getMacroName(self, name):
+        if (name.isdigit()):
+            return "universe" + name
+        return name
+
+    # ==> getReferences(text)
+    # Returns the names of the declared objects and universe macro's that are used in the pov ray text
+    #------------------------------------------------------------------------------------------------------------------
+    def getReferences(self, text):
+        references = re.findall('\\b(?:Geom_[0-9a-f]+|Clip_Cell\\d+|Complement_Cell\\d+|universe\\d+|Lat\\d+_(?:U|Row)\\d+)\\b', text)
+        return sorted(set(references))
+
+    # ==> readManifest()
+    # Read the manifest of the previous build
+    # The cells and declarations are only reused when the common input (surfaces, data cards, ...) is unchanged
+    #------------------------------------------------------------------------------------------------------------------
+    def readManifest(self):
+        fileName = os.path.join(self.directory, "manifest")
+        if (not os.path.isfile(fileName)):
+            return
+        inputHash = ""
+        for line in open(fileName).readlines():
+            items = line.rstrip("\n").split("\t")
+            if (items[0] == "INPUT"):
+                inputHash = items[1]
+            elif (items[0] == "FILE"):
+                self.previousHashes[items[1]] = items[2]
+            elif (items[0] == "CELL"):
+                owned = [owner.split(":", 1) for owner in self.splitList(items[4])]
+                self.previousCells[items[1]] = [items[2], items[3], owned, self.splitList(items[5])]
+            elif (items[0] == "UNIVERSE"):
+                self.previousUniverses[items[1]] = [int(items[2]), items[3], self.splitList(items[4])]
+            elif (items[0] == "OBJECT"):
+                self.previousObjects[items[1]] = self.splitList(items[2])
+
+        # the manifest is written again when the build is finished (see finish), so a build that is interrupted (i.e.
+        # cancelled by the GUI) doesn't leave a manifest of includes that it may have changed
+        os.remove(fileName)
+
+        if (inputHash != self.inputHash or not os.path.isfile(os.path.join(self.directory, "objects.inc"))):
+            self.previousCells = {}
+            self.previousUniverses = {}
+            self.previousObjects = {}
+
+    def splitList(self, text):
+        if (text == "-"):
+            return []
+        return text.split(",")
+
+    def joinList(self, items):
+        if (len(items) == 0):
+            return "-"
+        return ",".join(items)
+
+    # ==> isUnchanged(cellNumber, inputHash)
+    # Returns if the include of the cell of the previous build can be used (same input and all its includes exist)
+    #------------------------------------------------------------------------------------------------------------------
+    def isUnchanged(self, cellNumber, inputHash):
+        cellNumber = str(cellNumber)
+        if (not self.previousCells.has_key(cellNumber) or self.previousCells[cellNumber][0] != inputHash):
+            return False
+        if (self.previousCells[cellNumber][1] != "-" and not os.path.isfile(os.path.join(self.directory, "cell_" + cellNumber + ".inc"))):
+            return False
+        for kind, name in self.previousCells[cellNumber][2]:
+            if (kind == "U" and not (self.previousUniverses.has_key(name) and os.path.isfile(os.path.join(self.directory, "universe_" + name + ".inc")))):
+                return False
+            if (kind == "O" and not self.previousObjects.has_key(name)):
+                return False
+        return True
+
+    # ==> retainCell(cellNumber)
+    # Keep the include of a cell and the declarations it made in the previous build
+    # Returns the declarations ([kind, name]), so the parser doesn't declare them again
+    #------------------------------------------------------------------------------------------------------------------
+    def retainCell(self, cellNumber):
+        cellNumber = str(cellNumber)
+        self.cells[cellNumber] = self.previousCells[cellNumber]
+        for kind, name in self.cells[cellNumber][2]:
+            if (kind == "U"):
+                self.universes[name] = self.previousUniverses[name]
+            else:
+                self.retainedObjects[name] = self.previousObjects[name]
+        return self.cells[cellNumber][2]
+
+    # ==> releaseCell(cellNumber)
+    # Undo retainCell, the cell will be builded again
+    # Returns the declarations ([kind, name]) that are not declared anymore
+    #------------------------------------------------------------------------------------------------------------------
+    def releaseCell(self, cellNumber):
+        cellNumber = str(cellNumber)
+        owned = self.cells[cellNumber][2]
+        del self.cells[cellNumber]
+        for kind, name in owned:
+            if (kind == "U"):
+                del self.universes[name]
+            else:
+                del self.retainedObjects[name]
+        return owned
+
+    # ==> getMissingDeclarations(cellNumber)
+    # Returns the declarations that a retained cell uses, but that are not declared anymore in this build
+    # The objects of a retained cell are written before the new objects, so they can only use retained objects
+    #------------------------------------------------------------------------------------------------------------------
+    def getMissingDeclarations(self, cellNumber):
+        cell = self.cells[str(cellNumber)]
+        declared = {}
+        for name in self.universes.keys():
+            declared[self.getMacroName(name)] = True
+        for name in self.retainedObjects.keys() + self.objectNames.keys():
+            declared[name] = True
+
+        missing = [reference for reference in cell[3] if not declared.has_key(reference)]
+        for kind, name in cell[2]:
+            if (kind == "U"):
+                missing = missing + [reference for reference in self.universes[name][2] if not declared.has_key(reference)]
+            else:
+                missing = missing + [reference for reference in self.retainedObjects[name] if not self.retainedObjects.has_key(reference)]
+        return missing
+
+    # ==> writeInclude(name, text)
+    # Write an include file of the scene, only when its content changed since the previous build
+    # Returns the content hash
+    #------------------------------------------------------------------------------------------------------------------
+    def writeInclude(self, name, text):
+        contentHash = hashlib.md5(text).hexdigest()
+        fileName = os.path.join(self.directory, name)
+        if (self.previousHashes.get(name) != contentHash or not os.path.isfile(fileName)):
+            file = open(fileName, "w")
+            file.write(text)
+            file.close()
+            self.written = self.written + 1
+        return contentHash
+
+    # ==> writeUniverse(depth, name, text)
+    # Write the macro of a declared universe to its own include
+    #------------------------------------------------------------------------------------------------------------------
+    def writeUniverse(self, depth, name, text):
+        name = str(name)
+        text = "// UNIVERSE " + name + os.linesep + text
+        contentHash = self.writeInclude("universe_" + name + ".inc", text)
+        references = [reference for reference in self.getReferences(text) if reference != self.getMacroName(name)]
+        self.universes[name] = [depth, contentHash, references]
+        self.pending.append(["U", name])
+
+    # ==> writeObject(name, text)
+    # Write a declared object to the temporary file of the new objects (see writeObjects)
+    #------------------------------------------------------------------------------------------------------------------
+    def writeObject(self, name, text):
+        name = str(name)
+        self.objectSpool.writeln("// OBJECT " + name)
+        self.objectSpool.write(povray.Raw(text))
+        # skip the '#declare name =' line
+        self.objects.append([name, self.getReferences(text[text.find('\n'):])])
+        self.objectNames[name] = True
+        self.pending.append(["O", name])
+
+    # ==> writeCell(cellNumber, inputHash, text)
+    # Write a builded top level cell to its own include (text = 0 if the cell is empty)
+    # The cell owns the declarations that are made since the previous cell
+    #------------------------------------------------------------------------------------------------------------------
+    def writeCell(self, cellNumber, inputHash, text):
+        cellNumber = str(cellNumber)
+        if (text):
+            contentHash = self.writeInclude("cell_" + cellNumber + ".inc", text)
+            references = self.getReferences(text)
+        else:
+            contentHash = "-"
+            references = []
+        self.cells[cellNumber] = [inputHash, contentHash, self.pending, references]
+        self.pending = []
+
+    # ==> disownDeclarations()
+    # The declarations since the previous cell don't belong to a cell of the scene (i.e. the imp=0 cells)
+    # They are not retained, so they are declared again in every build
+    #------------------------------------------------------------------------------------------------------------------
+    def disownDeclarations(self):
+        self.pending = []
+
+    # ==> writeObjects()
+    # Write objects.inc: the retained objects in the order of the previous build, followed by the new objects
+    # The file is only replaced when its content changed
+    #------------------------------------------------------------------------------------------------------------------
+    def writeObjects(self):
+        fileName = os.path.join(self.directory, "objects.inc")
+        newFile = povray.File(fileName + ".new")
+        newFile.writeln("// DECLARED OBJECTS")
+        newFile.writeln("// ***************************************************************************")
+        if (self.retainedObjects and os.path.isfile(fileName)):
+            retain = False
+            for line in open(fileName):
+                if (line.startswith("// OBJECT ")):
+                    name = line[len("// OBJECT "):].strip()
+                    retain = self.retainedObjects.has_key(name)
+                    if (retain):
+                        self.retainedOrder.append(name)
+                if (retain):
+                    newFile.file.write(line)
+        newFile.copy(self.objectSpool.file)
+        newFile.file.close()
+        self.objectSpool.file.close()
+
+        contentHash = hashlib.md5(open(fileName + ".new", "rb").read()).hexdigest()
+        if (self.previousHashes.get("objects.inc") != contentHash or not os.path.isfile(fileName)):
+            if (os.path.isfile(fileName)):
+                os.remove(fileName)
+            os.rename(fileName + ".new", fileName)
+            self.written = self.written + 1
+        else:
+            os.remove(fileName + ".new")
+        return contentHash
+
+    # ==> finish(file, cellNumbers)
+    # Write the objects, the manifest and the includes of the scene to the povray file and remove the includes of
+    # the previous build that are not used anymore
+    #       file: povray file of the scene
+    #       cellNumbers: top level cells in the order of the union
+    #------------------------------------------------------------------------------------------------------------------
+    def finish(self, file, cellNumbers, conditions = {}):
+        objectsHash = self.writeObjects()
+
+        # remove the includes of cells and universes that are not part of the scene anymore
+        used = {"objects.inc": True, "manifest": True}
+        for name in self.universes.keys():
+            used["universe_" + name + ".inc"] = True
+        for number in self.cells.keys():
+            if (self.cells[number][1] != "-"):
+                used["cell_" + number + ".inc"] = True
+        for name in os.listdir(self.directory):
+            if (not used.has_key(name) and re.match('^(cell|universe)_.*\.inc$', name)):
+                os.remove(os.path.join(self.directory, name))
+
+        self.writeManifest(objectsHash)
+
+        file.include(self.getFileName("objects.inc"))
+        file.writeln("// DECLARED UNIVERSES")
+        file.writeln("// ***************************************************************************")
+        # sub universes first (see MCNPXParser.writeDeclarations)
+        for name in sorted(self.universes.keys(), key=lambda name: (-self.universes[name][0], name)):
+            file.writeln('#include "%s"' % self.getFileName("universe_" + name + ".inc"))
+
+        file.writeln("// All cells are combined in a big union")
+        file.writeln("union {")
+        file.indent()
+        file.writeln("object { Hidden_Object }") # the union stays valid when every cell is guarded away
+        for number in cellNumbers:
+            if (self.cells.has_key(str(number)) and self.cells[str(number)][1] != "-"):
+                include = '#include "%s"' % self.getFileName("cell_" + str(number) + ".inc")
+                if (conditions.has_key(number)):
+                    file.writeln("#if (" + conditions[number] + ")")
+                    file.writeln("  " + include)
+                    file.writeln("#end")
+                else:
+                    file.writeln(include)
+        file.dedent()
+        file.writeln("}")
+        file.writeln("")
+
+    # ==> writeManifest(objectsHash)
+    # Write the manifest of this build (see readManifest)
+    #------------------------------------------------------------------------------------------------------------------
+    def writeManifest(self, objectsHash):
+        file = open(os.path.join(self.directory, "manifest"), "w")
+        file.write("INPUT\t" + self.inputHash + "\n")
+        file.write("FILE\tobjects.inc\t" + objectsHash + "\n")
+        for number in sorted(self.cells.keys(), key=int):
+            cell = self.cells[number]
+            if (cell[1] != "-"):
+                file.write("FILE\tcell_" + number + ".inc\t" + cell[1] + "\n")
+            owned = self.joinList(sorted([kind + ":" + name for kind, name in cell[2]]))
+            file.write("CELL\t" + number + "\t" + cell[0] + "\t" + cell[1] + "\t" + owned + "\t" + self.joinList(cell[3]) + "\n")
+        for name in sorted(self.universes.keys()):
+            universe = self.universes[name]
+            file.write("FILE\tuniverse_" + name + ".inc\t" + universe[1] + "\n")
+            file.write("UNIVERSE\t" + name + "\t" + str(universe[0]) + "\t" + universe[1] + "\t" + self.joinList(universe[2]) + "\n")
+        # the objects in the order of objects.inc
+        for name in self.retainedOrder:
+            file.write("OBJECT\t" + name + "\t" + self.joinList(self.retainedObjects[name]) + "\n")
+        for name, references in self.objects:
+            file.write("OBJECT\t" + name + "\t" + self.joinList(references) + "\n")
+        file.close()
@@ -0,0 +1,373 @@
+//#########################################################################################################
+//## BoundingVolumeHierarchy.cpp
+//#########################################################################################################
+//##
+//## Bounding volume hierarchy over axis aligned boxes (i.e. the bounding boxes of the cells of a universe)
+//## The tree is built by the surface area heuristic and kept as one array of nodes in depth first order:
+//## the first child of a node follows the node, the node itself keeps the index of the second child.
+//## Point and ray queries return the ids of the items, so the geometry that owns the items does the exact tests.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "BoundingVolumeHierarchy.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#define MAX_LEAF_ITEMS 4		// a node with this many items is always a leaf
+#define MAX_SAH_LEAF_ITEMS 16	// a node with this many items can be a leaf if no split is cheaper
+#define SAH_BINS 16				// number of candidate split planes (per node, along the largest axis)
+#define MAX_SAH_DEPTH 48		// depth after which the nodes are split in two halves (keeps the tree within BVH_STACK_SIZE)
+#define TRAVERSAL_COST 1.0		// cost of visiting a node relative to the test of an item
+
+//####################################################################
+//#  BOX
+//####################################################################
+
+// ==> Box()
+// Constructor: an empty box
+//--------------------------------------------------------------------
+Box::Box()
+{
+	for (int i = 0; i < 3; i++)
+	{
+		_min[i] = std::numeric_limits<double>::infinity();
+		_max[i] = -std::numeric_limits<double>::infinity();
+	}
+}
+
+// ==> infinite()
+// Returns a box without bounds
+//--------------------------------------------------------------------
+Box Box::infinite()
+{
+	Box box;
+	for (int i = 0; i < 3; i++)
+	{
+		box._min[i] = -std::numeric_limits<double>::infinity();
+		box._max[i] = std::numeric_limits<double>::infinity();
+	}
+	return box;
+}
+
+// ==> isFinite()
+// Returns if all the bounds of the box are finite (an empty box is not)
+//--------------------------------------------------------------------
+bool Box::isFinite() const
+{
+	if (isEmpty())
+		return false;
+	for (int i = 0; i < 3; i++)
+		if (_min[i] == -std::numeric_limits<double>::infinity() || _max[i] == std::numeric_limits<double>::infinity())
+			return false;
+	return true;
+}
+
+// ==> grow(box)
+// Grow the box to contain another box
+//--------------------------------------------------------------------
+void Box::grow(const Box& box)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		_min[i] = std::min(_min[i], box._min[i]);
+		_max[i] = std::max(_max[i], box._max[i]);
+	}
+}
+
+// ==> grow(p)
+// Grow the box to contain a point
+//--------------------------------------------------------------------
+void Box::grow(const double p[3])
+{
+	for (int i = 0; i < 3; i++)
+	{
+		_min[i] = std::min(_min[i], p[i]);
+		_max[i] = std::max(_max[i], p[i]);
+	}
+}
+
+// ==> intersect(box)
+// Shrink the box to the overlap with another box
+//--------------------------------------------------------------------
+void Box::intersect(const Box& box)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		_min[i] = std::max(_min[i], box._min[i]);
+		_max[i] = std::min(_max[i], box._max[i]);
+	}
+}
+
+// ==> area()
+// Half of the surface area of the box (0 for an empty box)
+//--------------------------------------------------------------------
+double Box::area() const
+{
+	if (isEmpty())
+		return 0.0;
+	double dx = _max[0] - _min[0];
+	double dy = _max[1] - _min[1];
+	double dz = _max[2] - _min[2];
+	return dx*dy + dy*dz + dz*dx;
+}
+
+// ==> isCrossed(o, d, inverse, tMin, tMax)
+// Slab test of the ray o + t d (inverse = 1/d, not used for a zero component of d)
+//--------------------------------------------------------------------
+bool Box::isCrossed(const double o[3], const double d[3], const double inverse[3], double tMin, double tMax) const
+{
+	for (int i = 0; i < 3; i++)
+	{
+		if (d[i] == 0.0)
+		{
+			if (o[i] < _min[i] || o[i] > _max[i])
+				return false;
+			continue;
+		}
+		double t1 = (_min[i] - o[i])*inverse[i];
+		double t2 = (_max[i] - o[i])*inverse[i];
+		if (t1 > t2)
+			std::swap(t1, t2);
+		tMin = std::max(tMin, t1);
+		tMax = std::min(tMax, t2);
+		if (tMin > tMax)
+			return false;
+	}
+	return true;
+}
+
+//####################################################################
+//#  BUILD
+//####################################################################
+
+// ==> CentroidBin
+// Bin of an item along the split axis (for the partition of the items)
+//--------------------------------------------------------------------
+struct CentroidBin
+{
+	CentroidBin(const std::vector<double>& centroids, int axis, double min, double extent)
+		: _centroids(centroids), _axis(axis), _min(min), _extent(extent) {}
+
+	int operator()(int item) const
+	{
+		int bin = (int)(SAH_BINS*(_centroids[3*item + _axis] - _min)/_extent);
+		return std::max(0, std::min(bin, SAH_BINS - 1));
+	}
+
+	const std::vector<double>& _centroids;
+	int _axis;
+	double _min;
+	double _extent;
+};
+
+// ==> CentroidLeftOf
+// Item is in a bin left of (or in) the split bin
+//--------------------------------------------------------------------
+struct CentroidLeftOf
+{
+	CentroidLeftOf(const CentroidBin& bin, int split) : _bin(bin), _split(split) {}
+	bool operator()(int item) const { return _bin(item) <= _split; }
+
+	const CentroidBin& _bin;
+	int _split;
+};
+
+// ==> CentroidLess
+// Order of the items along an axis
+//--------------------------------------------------------------------
+struct CentroidLess
+{
+	CentroidLess(const std::vector<double>& centroids, int axis) : _centroids(centroids), _axis(axis) {}
+	bool operator()(int item1, int item2) const { return _centroids[3*item1 + _axis] < _centroids[3*item2 + _axis]; }
+
+	const std::vector<double>& _centroids;
+	int _axis;
+};
+
+// ==> BoundingVolumeHierarchy()
+// Constructor
+//--------------------------------------------------------------------
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{
+}
+
+// ==> ~BoundingVolumeHierarchy()
+// Destructor
+//--------------------------------------------------------------------
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+// ==> clear()
+// Remove the tree
+//--------------------------------------------------------------------
+void BoundingVolumeHierarchy::clear()
+{
+	_nodes.clear();
+	_items.clear();
+	_itemBoxes.clear();
+}
+
+// ==> build(boxes, ids)
+// Build the tree over the boxes, the queries return the id of the box
+//--------------------------------------------------------------------
+void BoundingVolumeHierarchy::build(const std::vector<Box>& boxes, const std::vector<int>& ids)
+{
+	clear();
+	if (boxes.empty())
+		return;
+
+	std::vector<int> order(boxes.size());
+	std::vector<double> centroids(3*boxes.size());
+	for (unsigned int i = 0; i < boxes.size(); i++)
+	{
+		order[i] = i;
+		for (int n = 0; n < 3; n++)
+			centroids[3*i + n] = 0.5*(boxes[i]._min[n] + boxes[i]._max[n]);
+	}
+
+	_nodes.reserve(2*boxes.size());
+	buildNode(order, boxes, centroids, 0, boxes.size(), 0);
+
+	_items.resize(boxes.size());
+	_itemBoxes.resize(boxes.size());
+	for (unsigned int i = 0; i < order.size(); i++)
+	{
+		_items[i] = ids[order[i]];
+		_itemBoxes[i] = boxes[order[i]];
+	}
+}
+
+// ==> buildNode(order, boxes, centroids, first, count, depth)
+// Add the node of the items order[first .. first + count - 1] and its children, returns the index of the node
+// The items are split at the cheapest of the planes between SAH_BINS bins of the centroids along the largest axis
+// (cost: area of a child times its number of items), or in two halves when there is no useful plane
+//--------------------------------------------------------------------
+int BoundingVolumeHierarchy::buildNode(std::vector<int>& order, const std::vector<Box>& boxes, const std::vector<double>& centroids,
+									int first, int count, int depth)
+{
+	int index = _nodes.size();
+	_nodes.push_back(BVHNode());
+
+	Box box;
+	Box centroidBox;
+	for (int i = first; i < first + count; i++)
+	{
+		box.grow(boxes[order[i]]);
+		centroidBox.grow(&centroids[3*order[i]]);
+	}
+	_nodes[index]._box = box;
+	_nodes[index]._first = first;
+	_nodes[index]._count = count;
+	if (count <= MAX_LEAF_ITEMS)
+		return index;
+
+	int axis = 0;
+	for (int n = 1; n < 3; n++)
+		if (centroidBox._max[n] - centroidBox._min[n] > centroidBox._max[axis] - centroidBox._min[axis])
+			axis = n;
+	double extent = centroidBox._max[axis] - centroidBox._min[axis];
+
+	int mid = -1;
+	if (extent > 0.0 && depth < MAX_SAH_DEPTH)
+	{
+		CentroidBin bin(centroids, axis, centroidBox._min[axis], extent);
+		int binCounts[SAH_BINS] = { 0 };
+		Box binBoxes[SAH_BINS];
+		for (int i = first; i < first + count; i++)
+		{
+			int b = bin(order[i]);
+			binCounts[b]++;
+			binBoxes[b].grow(boxes[order[i]]);
+		}
+
+		// cost of the split after bin i: the right side is swept from the end
+		double rightCosts[SAH_BINS];
+		Box right;
+		int rightCount = 0;
+		for (int i = SAH_BINS - 1; i > 0; i--)
+		{
+			right.grow(binBoxes[i]);
+			rightCount += binCounts[i];
+			rightCosts[i - 1] = right.area()*rightCount;
+		}
+
+		int split = -1;
+		double bestCost = count*box.area();
+		Box left;
+		int leftCount = 0;
+		for (int i = 0; i < SAH_BINS - 1; i++)
+		{
+			left.grow(binBoxes[i]);
+			leftCount += binCounts[i];
+			if (leftCount == 0 || leftCount == count)
+				continue;
+			double cost = TRAVERSAL_COST*box.area() + left.area()*leftCount + rightCosts[i];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				split = i;
+			}
+		}
+
+		if (split == -1 && count <= MAX_SAH_LEAF_ITEMS)
+			return index;
+		if (split != -1)
+			mid = std::partition(order.begin() + first, order.begin() + first + count, CentroidLeftOf(bin, split)) - order.begin();
+	}
+
+	if (mid <= first || mid >= first + count)
+	{
+		mid = first + count/2;
+		std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + first + count, CentroidLess(centroids, axis));
+	}
+
+	buildNode(order, boxes, centroids, first, mid - first, depth + 1);
+	int second = buildNode(order, boxes, centroids, mid, first + count - mid, depth + 1);
+	_nodes[index]._first = second;
+	_nodes[index]._count = 0;
+	return index;
+}
+
+//####################################################################
+//#  QUERIES
+//####################################################################
+
+// ==> findItems(o, d, tMin, tMax, ids)
+// Append the ids of the items of which the box is crossed by the ray o + t d between tMin and tMax
+//--------------------------------------------------------------------
+void BoundingVolumeHierarchy::findItems(const double o[3], const double d[3], double tMin, double tMax, std::vector<int>& ids) const
+{
+	if (_nodes.empty())
+		return;
+
+	double inverse[3];
+	for (int i = 0; i < 3; i++)
+		inverse[i] = (d[i] != 0.0) ? 1.0/d[i] : 0.0;
+
+	int stack[BVH_STACK_SIZE];
+	int size = 0;
+	stack[size++] = 0;
+	while (size > 0)
+	{
+		int index = stack[--size];
+		const BVHNode& node = _nodes[index];
+		if (!node._box.isCrossed(o, d, inverse, tMin, tMax))
+			continue;
+		if (node._count > 0)
+		{
+			for (int i = node._first; i < node._first + node._count; i++)
+				if (_itemBoxes[i].isCrossed(o, d, inverse, tMin, tMax))
+					ids.push_back(_items[i]);
+		}
+		else
+		{
+			stack[size++] = node._first;
+			stack[size++] = index + 1;
+		}
+	}
+}
@@ -0,0 +1,115 @@
+//#########################################################################################################
+//## BoundingVolumeHierarchy.h
+//#########################################################################################################
+//##
+//## Bounding volume hierarchy over axis aligned boxes (i.e. the bounding boxes of the cells of a universe)
+//## The tree is built by the surface area heuristic and kept as one array of nodes in depth first order:
+//## the first child of a node follows the node, the node itself keeps the index of the second child.
+//## Point and ray queries return the ids of the items, so the geometry that owns the items does the exact tests.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef BOUNDING_VOLUME_HIERARCHY_H
+#define BOUNDING_VOLUME_HIERARCHY_H
+
+#include <iostream>
+#include <vector>
+
+#define BVH_STACK_SIZE 128		// the build keeps the depth of the tree below this (see MAX_SAH_DEPTH)
+
+// An axis aligned box, that can be empty or (partially) infinite
+struct Box
+{
+	public:
+		// an empty box
+		Box();
+		static Box infinite();
+
+		bool isEmpty() const { return _min[0] > _max[0] || _min[1] > _max[1] || _min[2] > _max[2]; }
+		bool isFinite() const;
+		void grow(const Box& box);
+		void grow(const double p[3]);
+		// the overlap of two boxes (empty if they don't overlap)
+		void intersect(const Box& box);
+		bool contains(const double p[3]) const
+		{
+			return p[0] >= _min[0] && p[0] <= _max[0] && p[1] >= _min[1] && p[1] <= _max[1] && p[2] >= _min[2] && p[2] <= _max[2];
+		}
+		// half of the surface area
+		double area() const;
+		// Returns if the ray o + t d crosses the box between tMin and tMax (inverse = 1/d)
+		bool isCrossed(const double o[3], const double d[3], const double inverse[3], double tMin, double tMax) const;
+
+		double _min[3];
+		double _max[3];
+};
+
+// A node of the flattened tree
+struct BVHNode
+{
+	Box _box;
+	int _first;		// leaf: index of the first item, internal node: index of the second child
+	int _count;		// leaf: number of items, internal node: 0
+};
+
+class BoundingVolumeHierarchy
+{
+	public:
+		BoundingVolumeHierarchy();
+		~BoundingVolumeHierarchy();
+
+		// Build the tree over the boxes, the queries return the id of the box (boxes must be finite)
+		void build(const std::vector<Box>& boxes, const std::vector<int>& ids);
+		void clear();
+		bool isEmpty() const { return _nodes.empty(); }
+		int getNodeCount() const { return _nodes.size(); }
+
+		// Returns the id of the first item whose box contains the point and for which test(id) is true (-1 if there is none)
+		template <class Test> int findFirst(const double p[3], const Test& test) const;
+		// Append the ids of the items of which the box is crossed by the ray o + t d between tMin and tMax
+		void findItems(const double o[3], const double d[3], double tMin, double tMax, std::vector<int>& ids) const;
+
+	private:
+		int buildNode(std::vector<int>& order, const std::vector<Box>& boxes, const std::vector<double>& centroids,
+					int first, int count, int depth);
+
+		std::vector<BVHNode> _nodes;
+		std::vector<int> _items;		// ids of the items in the order of the leaves
+		std::vector<Box> _itemBoxes;	// boxes of the items in the order of the leaves
+};
+
+// ==> findFirst(p, test)
+// Walks the nodes of which the box contains the point, the items of the leaves are tested in order
+//--------------------------------------------------------------------
+template <class Test> int BoundingVolumeHierarchy::findFirst(const double p[3], const Test& test) const
+{
+	if (_nodes.empty())
+		return -1;
+
+	int stack[BVH_STACK_SIZE];
+	int size = 0;
+	stack[size++] = 0;
+	while (size > 0)
+	{
+		int index = stack[--size];
+		const BVHNode& node = _nodes[index];
+		if (!node._box.contains(p))
+			continue;
+		if (node._count > 0)
+		{
+			for (int i = node._first; i < node._first + node._count; i++)
+				if (_itemBoxes[i].contains(p) && test(_items[i]))
+					return _items[i];
+		}
+		else
+		{
+			stack[size++] = node._first;
+			stack[size++] = index + 1;
+		}
+	}
+	return -1;
+}
+
+#endif
@@ -0,0 +1,2210 @@
+//#########################################################################################################
+//## Geometry.cpp
+//#########################################################################################################
+//##
+//## Native representation of the surfaces and cells of a mcnpx file (written by MCNPXPreParser.py)
+//## Every surface is reduced to general quadrics (the coefficients of a GQ card), a macrobody to the
+//## intersection of its facets. The geometry of a cell is kept as a tree of surface senses, intersections,
+//## unions and complements, so the GUI can find the cell of a point itself (i.e. for the RayCaster)
+//## The tree of every cell is compiled once to a list of instructions (see GeometryInstruction), which is
+//## what the point in cell tests run. The TR cards are resolved once to affine maps (see Transformation):
+//## the surfaces of a TR card and the cells of a TRCL are moved when they are loaded, a FILL transformation
+//## is applied to the points that go into the universe (after the TRCL, which moves the filling with the cell).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "Geometry.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <QRegExp>
+#include <QCryptographicHash>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#define PI 3.14159265
+
+// depth of nested complements (#n) after which a cell is assumed to refer to itself
+#define MAX_COMPLEMENT_DEPTH 64
+// number of passes over an intersection in which its operands shrink the bounds of each other
+#define MAX_BOUND_PASSES 8
+// number of points in the bounds of a cell at which the compiler estimates how often an operand is true
+#define COMPILE_SAMPLES 64
+// depth of nested universes after which a universe is assumed to fill itself
+#define MAX_UNIVERSE_DEPTH 32
+// a findCell of many points evaluates the universe for all points at once if it has at most MAX_BATCH_QUADRICS quadrics
+// and MAX_BATCH_CELLS cells and there are at least MIN_BATCH_POINTS points, else it tests point by point
+#define MAX_BATCH_QUADRICS 64
+#define MAX_BATCH_CELLS 16
+#define MIN_BATCH_POINTS 16
+
+
+//####################################################################
+//#  QUADRIC
+//####################################################################
+
+// ==> Quadric()
+// Constructor: the zero quadric
+//--------------------------------------------------------------------
+Quadric::Quadric()
+{
+	for (int i = 0; i < 10; i++)
+		_c[i] = 0.0;
+}
+
+// ==> plane(nx, ny, nz, d)
+// Returns the plane nx x + ny y + nz z - d (the inside is on the opposite side of the normal)
+//--------------------------------------------------------------------
+Quadric Quadric::plane(double nx, double ny, double nz, double d)
+{
+	Quadric q;
+	q._c[6] = nx;
+	q._c[7] = ny;
+	q._c[8] = nz;
+	q._c[9] = -d;
+	return q;
+}
+
+// ==> fromMatrix(m, l, k)
+// Returns the quadric p^T M p + L.p + K of a symmetric matrix M
+//--------------------------------------------------------------------
+Quadric Quadric::fromMatrix(const double m[3][3], const double l[3], double k)
+{
+	Quadric q;
+	q._c[0] = m[0][0];
+	q._c[1] = m[1][1];
+	q._c[2] = m[2][2];
+	q._c[3] = 2*m[0][1];
+	q._c[4] = 2*m[1][2];
+	q._c[5] = 2*m[0][2];
+	q._c[6] = l[0];
+	q._c[7] = l[1];
+	q._c[8] = l[2];
+	q._c[9] = k;
+	return q;
+}
+
+// ==> getMatrix(q, m)
+// Symmetric matrix of the quadratic part of a quadric
+//--------------------------------------------------------------------
+static void getMatrix(const Quadric& q, double m[3][3])
+{
+	m[0][0] = q._c[0];
+	m[1][1] = q._c[1];
+	m[2][2] = q._c[2];
+	m[0][1] = m[1][0] = q._c[3]/2.0;
+	m[1][2] = m[2][1] = q._c[4]/2.0;
+	m[0][2] = m[2][0] = q._c[5]/2.0;
+}
+
+// ==> translate(c)
+// Move the quadric over c: Q(p - c) => L' = L - 2Mc and K' = K + c^T M c - L.c
+//--------------------------------------------------------------------
+void Quadric::translate(const double c[3])
+{
+	double m[3][3];
+	getMatrix(*this, m);
+	double constant = _c[9];
+	for (int i = 0; i < 3; i++)
+	{
+		double mc = m[i][0]*c[0] + m[i][1]*c[1] + m[i][2]*c[2];
+		constant += c[i]*mc - _c[6 + i]*c[i];
+		_c[6 + i] -= 2*mc;
+	}
+	_c[9] = constant;
+}
+
+// ==> transform(r, b)
+// Substitute x = R p + b in the quadric: M' = R^T M R, L' = R^T (2Mb + L) and K' = b^T M b + L.b + K
+//--------------------------------------------------------------------
+void Quadric::transform(const double r[3][3], const double b[3])
+{
+	double m[3][3];
+	getMatrix(*this, m);
+
+	double mr[3][3];
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			mr[i][j] = m[i][0]*r[0][j] + m[i][1]*r[1][j] + m[i][2]*r[2][j];
+
+	double mNew[3][3];
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			mNew[i][j] = r[0][i]*mr[0][j] + r[1][i]*mr[1][j] + r[2][i]*mr[2][j];
+
+	double v[3];
+	double k = _c[9];
+	for (int i = 0; i < 3; i++)
+	{
+		double mb = m[i][0]*b[0] + m[i][1]*b[1] + m[i][2]*b[2];
+		v[i] = 2*mb + _c[6 + i];
+		k += b[i]*mb + _c[6 + i]*b[i];
+	}
+
+	double l[3];
+	for (int i = 0; i < 3; i++)
+		l[i] = r[0][i]*v[0] + r[1][i]*v[1] + r[2][i]*v[2];
+
+	*this = fromMatrix(mNew, l, k);
+}
+
+// ==> evaluate(p)
+// Returns the value of the quadric in the point p
+//--------------------------------------------------------------------
+double Quadric::evaluate(const double p[3]) const
+{
+	return p[0]*(_c[0]*p[0] + _c[3]*p[1] + _c[6])
+		+ p[1]*(_c[1]*p[1] + _c[4]*p[2] + _c[7])
+		+ p[2]*(_c[2]*p[2] + _c[5]*p[0] + _c[8])
+		+ _c[9];
+}
+
+// ==> gradient(p, n)
+// The gradient of the quadric in the point p (the normal of the surface, pointing outwards)
+//--------------------------------------------------------------------
+void Quadric::gradient(const double p[3], double n[3]) const
+{
+	n[0] = 2*_c[0]*p[0] + _c[3]*p[1] + _c[5]*p[2] + _c[6];
+	n[1] = 2*_c[1]*p[1] + _c[3]*p[0] + _c[4]*p[2] + _c[7];
+	n[2] = 2*_c[2]*p[2] + _c[4]*p[1] + _c[5]*p[0] + _c[8];
+}
+
+// ==> intersect(o, d, t)
+// The roots of Q(o + t d) = a t^2 + b t + c, solved without cancellation
+// Returns the number of roots (the roots are sorted in t)
+//--------------------------------------------------------------------
+int Quadric::intersect(const double o[3], const double d[3], double t[2]) const
+{
+	double md[3];
+	md[0] = _c[0]*d[0] + 0.5*(_c[3]*d[1] + _c[5]*d[2]);
+	md[1] = _c[1]*d[1] + 0.5*(_c[3]*d[0] + _c[4]*d[2]);
+	md[2] = _c[2]*d[2] + 0.5*(_c[4]*d[1] + _c[5]*d[0]);
+
+	double a = d[0]*md[0] + d[1]*md[1] + d[2]*md[2];
+	double b = 2*(o[0]*md[0] + o[1]*md[1] + o[2]*md[2]) + _c[6]*d[0] + _c[7]*d[1] + _c[8]*d[2];
+	double c = evaluate(o);
+
+	if (a == 0.0)
+	{
+		if (b == 0.0)
+			return 0;
+		t[0] = -c/b;
+		return 1;
+	}
+
+	double discriminant = b*b - 4*a*c;
+	if (discriminant < 0.0)
+		return 0;
+
+	double q = -0.5*(b + (b < 0 ? -std::sqrt(discriminant) : std::sqrt(discriminant)));
+	if (q == 0.0)
+	{
+		t[0] = 0.0;
+		return 1;
+	}
+	t[0] = q/a;
+	t[1] = c/q;
+	if (t[0] > t[1])
+		std::swap(t[0], t[1]);
+	return 2;
+}
+
+
+//####################################################################
+//#  SHAPES
+//####################################################################
+
+// ==> sphere(c, r)
+// |p - c|^2 - r^2
+//--------------------------------------------------------------------
+static Quadric sphere(const double c[3], double r)
+{
+	Quadric q;
+	q._c[0] = q._c[1] = q._c[2] = 1.0;
+	q._c[9] = -r*r;
+	q.translate(c);
+	return q;
+}
+
+// ==> cone(apex, a, t2, radius, slope)
+// |q|^2 - (q.a)^2 - (radius + slope q.a)^2 - t2 (q.a)^2 with q = p - apex and the unit axis a
+// => cylinder: cone(c, a, 0, r, 0), cone with apex: cone(apex, a, t^2, 0, 0), truncated cone: cone(v, a, 0, r1, (r2-r1)/h)
+//--------------------------------------------------------------------
+static Quadric cone(const double apex[3], const double a[3], double t2, double radius, double slope)
+{
+	double m[3][3];
+	double l[3];
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+			m[i][j] = (i == j ? 1.0 : 0.0) - (1.0 + t2 + slope*slope)*a[i]*a[j];
+		l[i] = -2*radius*slope*a[i];
+	}
+	Quadric q = Quadric::fromMatrix(m, l, -radius*radius);
+	q.translate(apex);
+	return q;
+}
+
+// ==> axisVector(axis, a)
+// Unit vector of an axis (0 = x, 1 = y, 2 = z)
+//--------------------------------------------------------------------
+static void axisVector(int axis, double a[3])
+{
+	a[0] = a[1] = a[2] = 0.0;
+	a[axis] = 1.0;
+}
+
+// ==> addSlab(surface, v, a, length)
+// Add the two planes of the slab 0 <= a.(p - v) <= length (first the one at the end of the vector a)
+//--------------------------------------------------------------------
+static void addSlab(Surface& surface, const double v[3], const double a[3], double length)
+{
+	double av = a[0]*v[0] + a[1]*v[1] + a[2]*v[2];
+	surface._parts.push_back(Quadric::plane(a[0], a[1], a[2], av + length));
+	surface._parts.push_back(Quadric::plane(-a[0], -a[1], -a[2], -av));
+}
+
+// ==> normalize(a)
+// Normalize a vector in place, returns its length
+//--------------------------------------------------------------------
+static double normalize(double a[3])
+{
+	double length = std::sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+	if (length > 0.0)
+	{
+		a[0] /= length;
+		a[1] /= length;
+		a[2] /= length;
+	}
+	return length;
+}
+
+// ==> rotate(x, k, angle, result)
+// Rotate the vector x around the unit vector k (Rodrigues)
+//--------------------------------------------------------------------
+static void rotate(const double x[3], const double k[3], double angle, double result[3])
+{
+	double cross[3] = { k[1]*x[2] - k[2]*x[1], k[2]*x[0] - k[0]*x[2], k[0]*x[1] - k[1]*x[0] };
+	double dot = k[0]*x[0] + k[1]*x[1] + k[2]*x[2];
+	for (int i = 0; i < 3; i++)
+		result[i] = x[i]*std::cos(angle) + cross[i]*std::sin(angle) + k[i]*dot*(1 - std::cos(angle));
+}
+
+
+//####################################################################
+//#  INTERVALS
+//####################################################################
+
+// Interval arithmetic over the boxes of the cells (see IntervalBounds.py, which bounds the cells of the POV-Ray scene)
+struct Interval
+{
+	Interval(double min, double max) : _min(min), _max(max) {}
+	double _min;
+	double _max;
+};
+
+#define INF std::numeric_limits<double>::infinity()
+
+// ==> scaleInterval(factor, a)
+// factor * [a] (a zero factor gives zero, also for an infinite interval)
+//--------------------------------------------------------------------
+static Interval scaleInterval(double factor, const Interval& a)
+{
+	if (factor == 0.0)
+		return Interval(0.0, 0.0);
+	if (factor > 0.0)
+		return Interval(factor*a._min, factor*a._max);
+	return Interval(factor*a._max, factor*a._min);
+}
+
+// ==> multiplyInterval(a, b)
+// [a] * [b]
+//--------------------------------------------------------------------
+static Interval multiplyInterval(const Interval& a, const Interval& b)
+{
+	double values[2][2] = { { a._min, a._max }, { b._min, b._max } };
+	double min = INF;
+	double max = -INF;
+	for (int i = 0; i < 2; i++)
+	{
+		for (int j = 0; j < 2; j++)
+		{
+			double product = (values[0][i] == 0.0 || values[1][j] == 0.0) ? 0.0 : values[0][i]*values[1][j];
+			min = std::min(min, product);
+			max = std::max(max, product);
+		}
+	}
+	return Interval(min, max);
+}
+
+// ==> evaluateQuadratic(a, b, u)
+// a u^2 + b u, also for an infinite u
+//--------------------------------------------------------------------
+static double evaluateQuadratic(double a, double b, double u)
+{
+	if (u == INF || u == -INF)
+	{
+		if (a != 0.0)
+			return (a > 0.0) ? INF : -INF;
+		if (b != 0.0)
+			return ((b > 0.0) == (u > 0.0)) ? INF : -INF;
+		return 0.0;
+	}
+	return a*u*u + b*u;
+}
+
+// ==> quadraticInterval(a, b, u)
+// The exact range of a u^2 + b u for u in the interval
+//--------------------------------------------------------------------
+static Interval quadraticInterval(double a, double b, const Interval& u)
+{
+	double first = evaluateQuadratic(a, b, u._min);
+	double second = evaluateQuadratic(a, b, u._max);
+	Interval result(std::min(first, second), std::max(first, second));
+	if (a != 0.0 && u._min < -b/(2*a) && -b/(2*a) < u._max)
+	{
+		double top = evaluateQuadratic(a, b, -b/(2*a));
+		result._min = std::min(result._min, top);
+		result._max = std::max(result._max, top);
+	}
+	return result;
+}
+
+// ==> solveInterval(a, b, c, result)
+// The interval of u in which a u^2 + b u + c can be negative for some b in [b] and the minimal value c
+// Returns false if there is no such u (the interval is infinite if it can't be found)
+//--------------------------------------------------------------------
+static bool solveInterval(double a, const Interval& b, double c, Interval& result)
+{
+	result = Interval(-INF, INF);
+	if (c == -INF || b._min == -INF || b._max == INF || a < 0.0)
+		return true;
+	if (a == 0.0)
+	{
+		// b u + c < 0
+		if (b._min > 0.0)
+			result._max = std::max(-c/b._min, -c/b._max);
+		else if (b._max < 0.0)
+			result._min = std::min(-c/b._min, -c/b._max);
+		return true;
+	}
+
+	// u >= 0: a u^2 + b_min u + c < 0 and u <= 0: a u^2 + b_max u + c < 0
+	double positive = b._min*b._min - 4*a*c;
+	double negative = b._max*b._max - 4*a*c;
+	bool hasPositive = false;
+	bool hasNegative = false;
+	Interval positiveRoots(0.0, 0.0);
+	Interval negativeRoots(0.0, 0.0);
+	if (positive >= 0.0)
+	{
+		positiveRoots = Interval((-b._min - std::sqrt(positive))/(2*a), (-b._min + std::sqrt(positive))/(2*a));
+		hasPositive = positiveRoots._max >= 0.0;
+	}
+	if (negative >= 0.0)
+	{
+		negativeRoots = Interval((-b._max - std::sqrt(negative))/(2*a), (-b._max + std::sqrt(negative))/(2*a));
+		hasNegative = negativeRoots._min <= 0.0;
+	}
+	if (!hasPositive && !hasNegative)
+		return false;
+	if (!hasPositive)
+		result = Interval(negativeRoots._min, std::min(negativeRoots._max, 0.0));
+	else if (!hasNegative)
+		result = Interval(std::max(positiveRoots._min, 0.0), positiveRoots._max);
+	else
+		result = Interval(negativeRoots._min, positiveRoots._max);
+	return true;
+}
+
+// ==> contract(box, q)
+// Shrink every axis of the box to the part in which the quadric can be negative, given the other axes
+// For axis x the quadric is a x^2 + b x + c with a = A, b = Dy + Fz + G and c = the rest (intervals over the box)
+// Returns false if the quadric is positive in the entire box
+//--------------------------------------------------------------------
+static bool contract(Box& box, const Quadric& q)
+{
+	static const int cross[3][3] = { { -1, 3, 5 }, { 3, -1, 4 }, { 5, 4, -1 } };	// D (xy), E (yz), F (zx)
+	for (int n = 0; n < 3; n++)
+	{
+		int m1 = (n + 1) % 3;
+		int m2 = (n + 2) % 3;
+		Interval u1(box._min[m1], box._max[m1]);
+		Interval u2(box._min[m2], box._max[m2]);
+
+		Interval b(q._c[6 + n], q._c[6 + n]);
+		Interval c(q._c[9], q._c[9]);
+		Interval part = scaleInterval(q._c[cross[n][m1]], u1);
+		b = Interval(b._min + part._min, b._max + part._max);
+		part = scaleInterval(q._c[cross[n][m2]], u2);
+		b = Interval(b._min + part._min, b._max + part._max);
+		part = quadraticInterval(q._c[m1], q._c[6 + m1], u1);
+		c._min += part._min;
+		part = quadraticInterval(q._c[m2], q._c[6 + m2], u2);
+		c._min += part._min;
+		part = scaleInterval(q._c[cross[m1][m2]], multiplyInterval(u1, u2));
+		c._min += part._min;
+
+		Interval solution(-INF, INF);
+		if (!solveInterval(q._c[n], b, c._min, solution))
+			return false;
+		box._min[n] = std::max(box._min[n], solution._min);
+		box._max[n] = std::min(box._max[n], solution._max);
+		if (box._min[n] > box._max[n])
+			return false;
+	}
+	return true;
+}
+
+// ==> negate(q)
+// The quadric of the outside (positive sense) of a surface
+//--------------------------------------------------------------------
+static Quadric negate(const Quadric& q)
+{
+	Quadric result;
+	for (int i = 0; i < 10; i++)
+		result._c[i] = -q._c[i];
+	return result;
+}
+
+// ==> isSameBox(box1, box2)
+//--------------------------------------------------------------------
+static bool isSameBox(const Box& box1, const Box& box2)
+{
+	for (int i = 0; i < 3; i++)
+		if (box1._min[i] != box2._min[i] || box1._max[i] != box2._max[i])
+			return false;
+	return true;
+}
+
+
+//####################################################################
+//#  GEOMETRY
+//####################################################################
+
+// ==> Geometry()
+// Constructor
+//--------------------------------------------------------------------
+Geometry::Geometry()
+{
+}
+
+// ==> ~Geometry()
+// Destructor
+//--------------------------------------------------------------------
+Geometry::~Geometry()
+{
+}
+
+// ==> clear()
+// Remove all surfaces and cells
+//--------------------------------------------------------------------
+void Geometry::clear()
+{
+	_surfaces.clear();
+	_surfaceIndex.clear();
+	_store.clear();
+	_cells.clear();
+	_cellIndex.clear();
+	_nodes.clear();
+	_code.clear();
+	_lattices.clear();
+	_transformations.clear();
+	_universes.clear();
+	_hash = QString();
+}
+
+// ==> load(fileName)
+// Load the geometry file of MCNPXPreParser.py (see MCNPXParser.writeGeometryToFile) of the form
+//		TR&number&data												(*TR with the angles in degrees)
+//		SURFACE&number&transformation&mnemonic&data
+//		CELL&number&material&universe&fill&lattice&imp0&geometry
+//		LATTICE&cell&minI maxI minJ maxJ minK maxK&shape&universes	(see MCNPXParser.getLatticeShape)
+//		TRCL&cell&transformation&degrees&data						(see MCNPXParser.getCellTransformation)
+//		FILL&cell&transformation&degrees&data
+// A surface, cell, lattice or transformation that can't be interpreted is reported and left out
+//--------------------------------------------------------------------
+bool Geometry::load(QString fileName)
+{
+	clear();
+
+	QFile file(fileName);
+	if (!file.open(QFile::ReadOnly | QFile::Text))
+	{
+		std::cout << "ERROR (Geometry::load) => couldn't open geometry file " << fileName.toStdString() << std::endl;
+		return false;
+	}
+
+	// the surfaces refer to the transformations and the cells to each other, so every kind is read first
+	QStringList surfaceLines;
+	QStringList cellLines;
+	QStringList latticeLines;
+	QStringList transformationLines;
+
+	QCryptographicHash hash(QCryptographicHash::Md5);
+	QTextStream in(&file);
+	QString line;
+	while (!((line = in.readLine()).isNull()))
+	{
+		hash.addData(line.toUtf8());
+		QStringList list = line.split("&");
+		if (list.size() < 3)
+			continue;
+		if (list.at(0) == "TR" || list.at(0) == "*TR")
+		{
+			std::vector<double> data;
+			QStringList values = list.at(2).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+			for (int i = 0; i < values.size(); i++)
+				data.push_back(values.at(i).toDouble());
+			if (!_transformations.addCard(list.at(1).toInt(), data, list.at(0) == "*TR"))
+				std::cout << "ERROR (Geometry::load) => transformation " << list.at(1).toStdString() << " not supported" << std::endl;
+		}
+		else if (list.at(0) == "SURFACE")
+			surfaceLines.append(line);
+		else if (list.at(0) == "CELL")
+			cellLines.append(line);
+		else if (list.at(0) == "LATTICE")
+			latticeLines.append(line);
+		else if (list.at(0) == "TRCL" || list.at(0) == "FILL")
+			transformationLines.append(line);
+	}
+	file.close();
+	_hash = QString(hash.result().toHex());
+
+	// SURFACES
+	//--------------------------------------------------------------------
+	for (int n = 0; n < surfaceLines.size(); n++)
+	{
+		QStringList list = surfaceLines.at(n).split("&");
+		if (list.size() < 5)
+			continue;
+
+		Surface surface(list.at(1).toInt());
+		std::vector<double> data;
+		QStringList values = list.at(4).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+		for (int i = 0; i < values.size(); i++)
+			data.push_back(values.at(i).toDouble());
+
+		if (!createSurface(list.at(3), data, surface))
+		{
+			std::cout << "ERROR (Geometry::load) => surface " << surface._number << " of type " << list.at(3).toStdString() << " not supported" << std::endl;
+			continue;
+		}
+
+		int transformation = list.at(2).toInt();
+		if (transformation != 0)
+		{
+			int index = _transformations.find(transformation);
+			if (index != -1)
+				transformSurface(surface, _transformations.get(index));
+			else
+				std::cout << "ERROR (Geometry::load) => transformation " << transformation << " of surface " << surface._number << " not known" << std::endl;
+		}
+
+		surface._first = _store.getCount();
+		for (unsigned int i = 0; i < surface._parts.size(); i++)
+			_store.add(surface._parts[i]);
+		_surfaceIndex[surface._number] = _surfaces.size();
+		_surfaces.push_back(surface);
+	}
+
+	// CELLS
+	//--------------------------------------------------------------------
+	for (int n = 0; n < cellLines.size(); n++)
+	{
+		QStringList list = cellLines.at(n).split("&");
+		if (list.size() < 8)
+			continue;
+
+		GeometryCell cell;
+		cell._number = list.at(1).toInt();
+		cell._material = list.at(2).toInt();
+		cell._universe = list.at(3).toInt();
+		cell._fill = list.at(4).toInt();
+		cell._lattice = list.at(5).toInt();
+		cell._latticeIndex = -1;
+		cell._transformation = -1;
+		cell._trcl = -1;
+		cell._imp0 = (list.at(6).toInt() != 0);
+		cell._geometry = list.at(7);
+		cell._code = 0;
+		cell._codeSize = 0;
+
+		// a separate token for every bracket, union and complement
+		QString geometry = cell._geometry;
+		geometry.replace("(", " ( ").replace(")", " ) ").replace(":", " : ").replace("#", " # ");
+		QStringList tokens = geometry.split(QRegExp("\\s+"), QString::SkipEmptyParts);
+		int pos = 0;
+		cell._root = parseUnion(tokens, pos);
+		if (cell._root == -1 || pos != tokens.size())
+		{
+			std::cout << "ERROR (Geometry::load) => couldn't parse the geometry of cell " << cell._number << ": " << cell._geometry.toStdString() << std::endl;
+			cell._root = -1;
+		}
+
+		_cellIndex[cell._number] = _cells.size();
+		_universes[cell._universe]._cells.push_back(_cells.size());
+		_cells.push_back(cell);
+	}
+
+	// the complements (#n) refer to the cell index instead of the number
+	for (unsigned int n = 0; n < _nodes.size(); n++)
+	{
+		if (_nodes[n]._type != GeometryNode::CELL)
+			continue;
+		std::map<int, int>::iterator iter = _cellIndex.find(_nodes[n]._index);
+		if (iter == _cellIndex.end())
+		{
+			std::cout << "ERROR (Geometry::load) => complement of unknown cell " << _nodes[n]._index << std::endl;
+			_nodes[n]._index = -1;
+		}
+		else
+			_nodes[n]._index = iter->second;
+	}
+
+	// LATTICES
+	//--------------------------------------------------------------------
+	for (int n = 0; n < latticeLines.size(); n++)
+	{
+		QStringList list = latticeLines.at(n).split("&");
+		if (list.size() < 5)
+			continue;
+		std::map<int, int>::iterator iter = _cellIndex.find(list.at(1).toInt());
+		if (iter == _cellIndex.end() || _cells[iter->second]._lattice == 0)
+		{
+			std::cout << "ERROR (Geometry::load) => elements of unknown lattice " << list.at(1).toStdString() << std::endl;
+			continue;
+		}
+		GeometryCell& cell = _cells[iter->second];
+
+		QStringList ranges = list.at(2).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+		QStringList values = list.at(3).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+		QStringList universes = list.at(4).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+		std::vector<double> shape;
+		for (int i = 0; i < values.size(); i++)
+			shape.push_back((values.at(i) == "inf") ? std::numeric_limits<double>::infinity() : values.at(i).toDouble());
+
+		GeometryLattice lattice;
+		if (ranges.size() != 6 || !createLattice(cell._lattice, shape, lattice))
+		{
+			std::cout << "ERROR (Geometry::load) => couldn't interpret the elements of lattice " << cell._number << std::endl;
+			continue;
+		}
+		for (int i = 0; i < 3; i++)
+		{
+			lattice._range[i][0] = ranges.at(2*i).toInt();
+			lattice._range[i][1] = ranges.at(2*i + 1).toInt();
+		}
+		for (int i = 0; i < universes.size(); i++)
+			lattice._universes.push_back(universes.at(i).toInt());
+		cell._latticeIndex = _lattices.size();
+		_lattices.push_back(lattice);
+	}
+
+	// TRANSFORMATIONS
+	// a TRCL moves the surfaces of the cell and is kept to move the points that go into the filling or lattice the
+	// other way, a FILL transformation is kept for the points that go into the universe
+	//--------------------------------------------------------------------
+	for (int n = 0; n < transformationLines.size(); n++)
+	{
+		QStringList list = transformationLines.at(n).split("&");
+		if (list.size() < 5)
+			continue;
+		std::map<int, int>::iterator iter = _cellIndex.find(list.at(1).toInt());
+		if (iter == _cellIndex.end())
+		{
+			std::cout << "ERROR (Geometry::load) => " << list.at(0).toStdString() << " transformation of unknown cell " << list.at(1).toStdString() << std::endl;
+			continue;
+		}
+
+		int index = -1;
+		int number = list.at(2).toInt();
+		if (number != 0)
+			index = _transformations.find(number);
+		else
+		{
+			std::vector<double> data;
+			QStringList values = list.at(4).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+			for (int i = 0; i < values.size(); i++)
+				data.push_back(values.at(i).toDouble());
+			Transformation transformation;
+			if (Transformation::fromCard(data, list.at(3).toInt() != 0, transformation))
+				index = _transformations.add(transformation);
+		}
+		if (index == -1)
+		{
+			std::cout << "ERROR (Geometry::load) => couldn't interpret the " << list.at(0).toStdString() << " transformation of cell " << list.at(1).toStdString() << std::endl;
+			continue;
+		}
+
+		if (list.at(0) == "TRCL")
+		{
+			moveCell(iter->second, _transformations.get(index));
+			_cells[iter->second]._trcl = index;
+		}
+		else
+			_cells[iter->second]._transformation = index;
+	}
+
+	// the surfaces that a cell and a universe use (including the surfaces of the complemented cells)
+	std::vector<int> marks(_surfaces.size(), -1);
+	for (unsigned int n = 0; n < _cells.size(); n++)
+		collectSurfaces(_cells[n]._root, marks, n, _cells[n]._surfaces, 0);
+	int mark = _cells.size();
+	std::map<int, GeometryUniverse>::iterator iter;
+	for (iter = _universes.begin(); iter != _universes.end(); ++iter, ++mark)
+	{
+		for (unsigned int i = 0; i < iter->second._cells.size(); i++)
+		{
+			const std::vector<int>& surfaces = _cells[iter->second._cells[i]]._surfaces;
+			for (unsigned int j = 0; j < surfaces.size(); j++)
+			{
+				if (marks[surfaces[j]] != mark)
+				{
+					marks[surfaces[j]] = mark;
+					iter->second._surfaces.push_back(surfaces[j]);
+				}
+			}
+		}
+		std::sort(iter->second._surfaces.begin(), iter->second._surfaces.end());
+		for (unsigned int i = 0; i < iter->second._surfaces.size(); i++)
+		{
+			const Surface& surface = _surfaces[iter->second._surfaces[i]];
+			for (unsigned int j = 0; j < surface._parts.size(); j++)
+				iter->second._quadrics.push_back(surface._first + j);
+		}
+	}
+
+	buildHierarchies();
+	compileCells();
+	return true;
+}
+
+// ==> buildHierarchies()
+// Bound every cell and build the hierarchy of every universe over its bounded cells
+// The bounds are widened a little, a point on a surface of the cell must stay inside them
+// A lattice has no bounds, its elements repeat through the whole universe
+//--------------------------------------------------------------------
+void Geometry::buildHierarchies()
+{
+	for (unsigned int n = 0; n < _cells.size(); n++)
+	{
+		Box box = Box::infinite();
+		if (_cells[n]._latticeIndex != -1)
+		{
+			_cells[n]._box = box;
+			continue;
+		}
+		if (_cells[n]._root == -1 || !bound(_cells[n]._root, box, 0))
+			box = Box();
+		for (int i = 0; i < 3 && !box.isEmpty(); i++)
+		{
+			box._min[i] -= 1e-9*(1.0 + std::fabs(box._min[i]));
+			box._max[i] += 1e-9*(1.0 + std::fabs(box._max[i]));
+		}
+		_cells[n]._box = box;
+	}
+
+	std::map<int, GeometryUniverse>::iterator iter;
+	for (iter = _universes.begin(); iter != _universes.end(); ++iter)
+	{
+		GeometryUniverse& universe = iter->second;
+		std::vector<Box> boxes;
+		std::vector<int> ids;
+		universe._unboundedCells.clear();
+		for (unsigned int i = 0; i < universe._cells.size(); i++)
+		{
+			const Box& box = _cells[universe._cells[i]]._box;
+			if (box.isFinite())
+			{
+				boxes.push_back(box);
+				ids.push_back(universe._cells[i]);
+			}
+			else if (!box.isEmpty())
+				universe._unboundedCells.push_back(universe._cells[i]);
+		}
+		universe._hierarchy.build(boxes, ids);
+	}
+}
+
+// ==> bound(node, box, depth)
+// Shrink the box to the bounds of the region of the node (see IntervalBounds.py)
+//		surface: the inside of all the parts or the outside of one of them, contracted by interval arithmetic
+//		intersection: every operand shrinks the box, until it doesn't change anymore
+//		union: the hull of the bounds of the operands
+//		complement: no bounds
+// Returns false if the region doesn't overlap with the box
+//--------------------------------------------------------------------
+bool Geometry::bound(int node, Box& box, int depth) const
+{
+	const GeometryNode& geometryNode = _nodes[node];
+	switch (geometryNode._type)
+	{
+		case GeometryNode::SURFACE:
+		{
+			const Surface& surface = _surfaces[geometryNode._index];
+			if (geometryNode._facet != -1)
+			{
+				const Quadric& part = surface._parts[geometryNode._facet];
+				return contract(box, geometryNode._negative ? part : negate(part));
+			}
+			if (geometryNode._negative)
+			{
+				for (int pass = 0; pass < MAX_BOUND_PASSES; pass++)
+				{
+					Box previous = box;
+					for (unsigned int i = 0; i < surface._parts.size(); i++)
+						if (!contract(box, surface._parts[i]))
+							return false;
+					if (isSameBox(box, previous))
+						break;
+				}
+				return true;
+			}
+			Box hull;
+			for (unsigned int i = 0; i < surface._parts.size(); i++)
+			{
+				Box partBox = box;
+				if (contract(partBox, negate(surface._parts[i])))
+					hull.grow(partBox);
+			}
+			box = hull;
+			return !box.isEmpty();
+		}
+		case GeometryNode::INTERSECTION:
+			for (int pass = 0; pass < MAX_BOUND_PASSES; pass++)
+			{
+				Box previous = box;
+				for (unsigned int i = 0; i < geometryNode._children.size(); i++)
+					if (!bound(geometryNode._children[i], box, depth))
+						return false;
+				if (isSameBox(box, previous))
+					break;
+			}
+			return true;
+		case GeometryNode::UNION:
+		{
+			Box hull;
+			for (unsigned int i = 0; i < geometryNode._children.size(); i++)
+			{
+				Box childBox = box;
+				if (bound(geometryNode._children[i], childBox, depth))
+					hull.grow(childBox);
+			}
+			box = hull;
+			return !box.isEmpty();
+		}
+		case GeometryNode::COMPLEMENT:
+		case GeometryNode::CELL:
+			return true;
+	}
+	return true;
+}
+
+// ==> createSurface(mnemonic, data, surface)
+// Reduce the surface card to its quadrics (see MCNPXParser.buildSurfaceCard for the forms of the cards)
+// The parts of a macrobody are in the order of its facets (i.e. -5.2 is the inside of the second facet of 5)
+// Returns false if the type is not supported or the number of arguments is wrong
+//--------------------------------------------------------------------
+bool Geometry::createSurface(QString mnemonic, const std::vector<double>& data, Surface& surface)
+{
+	const double* v = data.empty() ? 0 : &data[0];
+	unsigned int n = data.size();
+	double a[3];
+	double c[3];
+	QString type = mnemonic.toUpper();
+
+	// PLANES
+	if (type == "P" && n == 4)
+		surface._parts.push_back(Quadric::plane(v[0], v[1], v[2], v[3]));
+	else if ((type == "PX" || type == "PY" || type == "PZ") && n == 1)
+	{
+		axisVector(type.at(1).toAscii() - 'X', a);
+		surface._parts.push_back(Quadric::plane(a[0], a[1], a[2], v[0]));
+	}
+
+	// SPHERES
+	else if ((type == "SO" || type == "S0") && n == 1)
+	{
+		c[0] = c[1] = c[2] = 0.0;
+		surface._parts.push_back(sphere(c, v[0]));
+	}
+	else if ((type == "S" && n == 4) || (type == "SPH" && n == 4))
+		surface._parts.push_back(sphere(v, v[3]));
+	else if ((type == "SX" || type == "SY" || type == "SZ") && n == 2)
+	{
+		axisVector(type.at(1).toAscii() - 'X', a);
+		c[0] = a[0]*v[0];
+		c[1] = a[1]*v[0];
+		c[2] = a[2]*v[0];
+		surface._parts.push_back(sphere(c, v[1]));
+	}
+
+	// CYLINDERS
+	else if ((type == "C/X" || type == "C/Y" || type == "C/Z") && n == 3)
+	{
+		int axis = type.at(2).toAscii() - 'X';
+		axisVector(axis, a);
+		c[axis] = 0.0;
+		c[axis == 0 ? 1 : 0] = v[0];
+		c[axis == 2 ? 1 : 2] = v[1];
+		surface._parts.push_back(cone(c, a, 0.0, v[2], 0.0));
+	}
+	else if ((type == "CX" || type == "CY" || type == "CZ") && n == 1)
+	{
+		axisVector(type.at(1).toAscii() - 'X', a);
+		c[0] = c[1] = c[2] = 0.0;
+		surface._parts.push_back(cone(c, a, 0.0, v[0], 0.0));
+	}
+
+	// CONES (the optional sheet is the side of the apex on the axis)
+	else if ((type == "K/X" || type == "K/Y" || type == "K/Z") && (n == 4 || n == 5))
+	{
+		int axis = type.at(2).toAscii() - 'X';
+		axisVector(axis, a);
+		surface._parts.push_back(cone(v, a, v[3], 0.0, 0.0));
+		if (n == 5 && v[4] != 0.0)
+		{
+			double sheet = v[4] > 0 ? -1.0 : 1.0;
+			surface._parts.push_back(Quadric::plane(sheet*a[0], sheet*a[1], sheet*a[2], sheet*v[axis]));
+		}
+	}
+	else if ((type == "KX" || type == "KY" || type == "KZ") && (n == 2 || n == 3))
+	{
+		int axis = type.at(1).toAscii() - 'X';
+		axisVector(axis, a);
+		c[0] = a[0]*v[0];
+		c[1] = a[1]*v[0];
+		c[2] = a[2]*v[0];
+		surface._parts.push_back(cone(c, a, v[1], 0.0, 0.0));
+		if (n == 3 && v[2] != 0.0)
+		{
+			double sheet = v[2] > 0 ? -1.0 : 1.0;
+			surface._parts.push_back(Quadric::plane(sheet*a[0], sheet*a[1], sheet*a[2], sheet*v[0]));
+		}
+	}
+
+	// ELLIPSOID, HYPERBOLOID, PARABOLOID
+	// SQ: A(x-x')^2 + B(y-y')^2 + C(z-z')^2 + 2D(x-x') + 2E(y-y') + 2F(z-z') + G
+	else if (type == "SQ" && n == 10)
+	{
+		double m[3][3] = { { v[0], 0.0, 0.0 }, { 0.0, v[1], 0.0 }, { 0.0, 0.0, v[2] } };
+		double l[3] = { 2*v[3], 2*v[4], 2*v[5] };
+		Quadric q = Quadric::fromMatrix(m, l, v[6]);
+		q.translate(&v[7]);
+		surface._parts.push_back(q);
+	}
+	// GQ: Ax^2 + By^2 + Cz^2 + Dxy + Eyz + Fzx + Gx + Hy + Jz + K
+	else if (type == "GQ" && n == 10)
+	{
+		Quadric q;
+		for (int i = 0; i < 10; i++)
+			q._c[i] = v[i];
+		surface._parts.push_back(q);
+	}
+
+	// MACROBODIES
+	// RPP: facets +x, -x, +y, -y, +z, -z
+	else if (type == "RPP" && n == 6)
+	{
+		for (int axis = 0; axis < 3; axis++)
+		{
+			axisVector(axis, a);
+			c[0] = c[1] = c[2] = 0.0;
+			c[axis] = v[2*axis];
+			addSlab(surface, c, a, v[2*axis + 1] - v[2*axis]);
+		}
+	}
+	// BOX: facets +a1, -a1, +a2, -a2, +a3, -a3 (without a3 the box is infinite along the third axis)
+	else if (type == "BOX" && (n == 12 || n == 9))
+	{
+		for (unsigned int i = 3; i < n; i += 3)
+		{
+			a[0] = v[i];
+			a[1] = v[i + 1];
+			a[2] = v[i + 2];
+			double length = normalize(a);
+			addSlab(surface, v, a, length);
+		}
+	}
+	// RCC: facets cylinder, top and bottom
+	// TRC: facets cone, top and bottom
+	else if ((type == "RCC" && n == 7) || (type == "TRC" && n == 8))
+	{
+		a[0] = v[3];
+		a[1] = v[4];
+		a[2] = v[5];
+		double height = normalize(a);
+		if (height == 0.0)
+			return false;
+		double slope = (type == "TRC") ? (v[7] - v[6])/height : 0.0;
+		surface._parts.push_back(cone(v, a, 0.0, v[6], slope));
+		addSlab(surface, v, a, height);
+	}
+	// RHP/HEX: facets +r1, -r1, +r2, -r2, +r3, -r3, top and bottom
+	// (r1 points to the middle of the first facet, without r2 and r3 the hexagonal prism is regular)
+	else if ((type == "RHP" || type == "HEX") && (n == 9 || n == 15))
+	{
+		double h[3] = { v[3], v[4], v[5] };
+		double height = normalize(h);
+		if (height == 0.0)
+			return false;
+		double r[3][3];
+		for (int i = 0; i < 3; i++)
+			r[0][i] = v[6 + i];
+		if (n == 15)
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				r[1][i] = v[9 + i];
+				r[2][i] = v[12 + i];
+			}
+		}
+		else
+		{
+			rotate(r[0], h, 60.0*PI/180.0, r[1]);
+			rotate(r[0], h, 120.0*PI/180.0, r[2]);
+		}
+		for (int side = 0; side < 3; side++)
+		{
+			double length = normalize(r[side]);
+			double shift[3] = { v[0] - length*r[side][0], v[1] - length*r[side][1], v[2] - length*r[side][2] };
+			addSlab(surface, shift, r[side], 2*length);
+		}
+		addSlab(surface, v, h, height);
+	}
+	else
+		return false;
+
+	return true;
+}
+
+// ==> transformSurface(surface, transformation)
+// Move the surface from the auxiliary coordinates of a TR card to the main coordinates: the quadrics of the
+// auxiliary coordinates are evaluated in x' = R x + b (see Transformation::fromCard)
+//--------------------------------------------------------------------
+void Geometry::transformSurface(Surface& surface, const Transformation& transformation)
+{
+	double r[3][3];
+	double b[3];
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+			r[i][j] = transformation._forward[i][j];
+		b[i] = transformation._forward[i][3];
+	}
+
+	for (unsigned int i = 0; i < surface._parts.size(); i++)
+		surface._parts[i].transform(r, b);
+}
+
+// ==> moveCell(cell, transformation)
+// Move the cell (index) with its TRCL: the surfaces of the cell are copied and moved like the surfaces of a TR card,
+// the copies get the number 1000 * cell + surface (like MCNPX numbers them). The complemented cells (#n) stay.
+//--------------------------------------------------------------------
+void Geometry::moveCell(int cell, const Transformation& transformation)
+{
+	std::map<int, int> moved;
+	moveNode(_cells[cell]._root, transformation, moved, _cells[cell]._number);
+}
+
+// ==> moveNode(node, transformation, moved, number)
+// Let the surface nodes of the tree refer to moved copies of their surfaces (moved: surface index => index of the copy)
+//--------------------------------------------------------------------
+void Geometry::moveNode(int node, const Transformation& transformation, std::map<int, int>& moved, int number)
+{
+	if (node == -1 || _nodes[node]._type == GeometryNode::CELL)
+		return;
+
+	if (_nodes[node]._type == GeometryNode::SURFACE)
+	{
+		std::map<int, int>::iterator iter = moved.find(_nodes[node]._index);
+		if (iter == moved.end())
+		{
+			Surface surface = _surfaces[_nodes[node]._index];
+			surface._number += 1000*number;
+			transformSurface(surface, transformation);
+			surface._first = _store.getCount();
+			for (unsigned int i = 0; i < surface._parts.size(); i++)
+				_store.add(surface._parts[i]);
+			iter = moved.insert(std::make_pair(_nodes[node]._index, (int)_surfaces.size())).first;
+			_surfaces.push_back(surface);
+		}
+		_nodes[node]._index = iter->second;
+		return;
+	}
+
+	for (unsigned int i = 0; i < _nodes[node]._children.size(); i++)
+		moveNode(_nodes[node]._children[i], transformation, moved, number);
+}
+
+// ==> addNode(type)
+// Add an empty node to the geometry trees, returns its index
+//--------------------------------------------------------------------
+int Geometry::addNode(GeometryNode::Type type)
+{
+	GeometryNode node;
+	node._type = type;
+	node._index = -1;
+	node._facet = -1;
+	node._negative = false;
+	_nodes.push_back(node);
+	return _nodes.size() - 1;
+}
+
+// ==> parseUnion(tokens, pos)
+// union := intersection (':' intersection)*
+// The union has the lowest precedence, the complement the highest (see MCNPX manual)
+// Returns the index of the node (-1 on a syntax error)
+//--------------------------------------------------------------------
+int Geometry::parseUnion(const QStringList& tokens, int& pos)
+{
+	std::vector<int> children;
+	int child = parseIntersection(tokens, pos);
+	if (child == -1)
+		return -1;
+	children.push_back(child);
+	while (pos < tokens.size() && tokens.at(pos) == ":")
+	{
+		pos++;
+		child = parseIntersection(tokens, pos);
+		if (child == -1)
+			return -1;
+		children.push_back(child);
+	}
+	if (children.size() == 1)
+		return children[0];
+
+	int node = addNode(GeometryNode::UNION);
+	_nodes[node]._children = children;
+	return node;
+}
+
+// ==> parseIntersection(tokens, pos)
+// intersection := factor factor* (the factors are separated by spaces)
+//--------------------------------------------------------------------
+int Geometry::parseIntersection(const QStringList& tokens, int& pos)
+{
+	std::vector<int> children;
+	while (pos < tokens.size() && tokens.at(pos) != ":" && tokens.at(pos) != ")")
+	{
+		int child = parseFactor(tokens, pos);
+		if (child == -1)
+			return -1;
+		children.push_back(child);
+	}
+	if (children.size() == 0)
+		return -1;
+	if (children.size() == 1)
+		return children[0];
+
+	int node = addNode(GeometryNode::INTERSECTION);
+	_nodes[node]._children = children;
+	return node;
+}
+
+// ==> parseFactor(tokens, pos)
+// factor := '(' union ')' | '#' '(' union ')' | '#' cell | [+-]surface[.facet]
+//--------------------------------------------------------------------
+int Geometry::parseFactor(const QStringList& tokens, int& pos)
+{
+	QString token = tokens.at(pos++);
+
+	if (token == "(")
+	{
+		int node = parseUnion(tokens, pos);
+		if (node == -1 || pos >= tokens.size() || tokens.at(pos) != ")")
+			return -1;
+		pos++;
+		return node;
+	}
+
+	if (token == "#")
+	{
+		if (pos >= tokens.size())
+			return -1;
+		if (tokens.at(pos) == "(")
+		{
+			int child = parseFactor(tokens, pos);
+			if (child == -1)
+				return -1;
+			int node = addNode(GeometryNode::COMPLEMENT);
+			_nodes[node]._children.push_back(child);
+			return node;
+		}
+		bool ok;
+		int cell = tokens.at(pos++).toInt(&ok);
+		if (!ok)
+			return -1;
+		int node = addNode(GeometryNode::CELL);
+		_nodes[node]._index = cell; // replaced by the index when all cells are known
+		return node;
+	}
+
+	// surface with an optional sense and facet
+	bool negative = token.startsWith("-");
+	if (negative || token.startsWith("+"))
+		token = token.mid(1);
+	QStringList parts = token.split(".");
+	bool ok;
+	int number = parts.at(0).toInt(&ok);
+	if (!ok)
+		return -1;
+	std::map<int, int>::iterator iter = _surfaceIndex.find(number);
+	if (iter == _surfaceIndex.end())
+	{
+		std::cout << "ERROR (Geometry::parseFactor) => surface " << number << " not known" << std::endl;
+		return -1;
+	}
+
+	int node = addNode(GeometryNode::SURFACE);
+	_nodes[node]._index = iter->second;
+	_nodes[node]._negative = negative;
+	if (parts.size() == 2)
+	{
+		int facet = parts.at(1).toInt(&ok) - 1;
+		if (!ok || facet < 0 || facet >= (int)_surfaces[iter->second]._parts.size() || _surfaces[iter->second]._parts.size() < 3)
+			return -1;
+		_nodes[node]._facet = facet;
+	}
+	return node;
+}
+
+// ==> collectSurfaces(node, marks, mark, surfaces, depth)
+// Append the surfaces that a geometry tree uses (including the trees of the complemented cells) to surfaces
+// A surface is only appended once: it gets the mark in marks (per surface index)
+//--------------------------------------------------------------------
+void Geometry::collectSurfaces(int node, std::vector<int>& marks, int mark, std::vector<int>& surfaces, int depth) const
+{
+	if (node == -1 || depth > MAX_COMPLEMENT_DEPTH)
+		return;
+	const GeometryNode& geometryNode = _nodes[node];
+	if (geometryNode._type == GeometryNode::SURFACE)
+	{
+		if (marks[geometryNode._index] != mark)
+		{
+			marks[geometryNode._index] = mark;
+			surfaces.push_back(geometryNode._index);
+		}
+	}
+	else if (geometryNode._type == GeometryNode::CELL)
+	{
+		if (geometryNode._index != -1)
+			collectSurfaces(_cells[geometryNode._index]._root, marks, mark, surfaces, depth + 1);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < geometryNode._children.size(); i++)
+			collectSurfaces(geometryNode._children[i], marks, mark, surfaces, depth);
+	}
+}
+
+// ==> getUniverse(universe)
+// Returns the cells and surfaces of a universe (0 if the universe is not known)
+//--------------------------------------------------------------------
+const GeometryUniverse* Geometry::getUniverse(int universe) const
+{
+	std::map<int, GeometryUniverse>::const_iterator iter = _universes.find(universe);
+	if (iter == _universes.end())
+		return 0;
+	return &iter->second;
+}
+
+// ==> evaluate(node, p, depth)
+// Returns if the point is in the region of the node (intersections and unions stop at the first decisive operand)
+// A point on a surface is on the positive side of it. Only used by the compiler and isInsideTree, the tests run the
+// compiled code.
+//--------------------------------------------------------------------
+bool Geometry::evaluate(int node, const double p[3], int depth) const
+{
+	const GeometryNode& geometryNode = _nodes[node];
+	switch (geometryNode._type)
+	{
+		case GeometryNode::SURFACE:
+		{
+			const Surface& surface = _surfaces[geometryNode._index];
+			double value = (geometryNode._facet == -1) ? surface.evaluate(p) : surface._parts[geometryNode._facet].evaluate(p);
+			return (value < 0.0) == geometryNode._negative;
+		}
+		case GeometryNode::INTERSECTION:
+			for (unsigned int i = 0; i < geometryNode._children.size(); i++)
+				if (!evaluate(geometryNode._children[i], p, depth))
+					return false;
+			return true;
+		case GeometryNode::UNION:
+			for (unsigned int i = 0; i < geometryNode._children.size(); i++)
+				if (evaluate(geometryNode._children[i], p, depth))
+					return true;
+			return false;
+		case GeometryNode::COMPLEMENT:
+			return !evaluate(geometryNode._children[0], p, depth);
+		case GeometryNode::CELL:
+			if (geometryNode._index == -1 || depth > MAX_COMPLEMENT_DEPTH || _cells[geometryNode._index]._root == -1)
+				return true;
+			return !evaluate(_cells[geometryNode._index]._root, p, depth + 1);
+	}
+	return false;
+}
+
+// ==> run(cell, p, depth)
+// Returns if the point is in the cell (index): runs the compiled geometry, the last test is the result
+// The complement of an unknown or unparsed cell, or of a cell nested deeper than MAX_COMPLEMENT_DEPTH, contains every point
+//--------------------------------------------------------------------
+bool Geometry::run(int cell, const double p[3], int depth) const
+{
+	const GeometryInstruction* code = &_code[0] + _cells[cell]._code;
+	int size = _cells[cell]._codeSize;
+	bool value = false;
+	int pc = 0;
+	while (pc < size)
+	{
+		const GeometryInstruction& instruction = code[pc];
+		switch (instruction._operation)
+		{
+			case GeometryInstruction::INSIDE:
+				value = _store.evaluate(instruction._operand, p) < 0.0;
+				break;
+			case GeometryInstruction::OUTSIDE:
+				value = !(_store.evaluate(instruction._operand, p) < 0.0);
+				break;
+			case GeometryInstruction::JUMP_IF_FALSE:
+				if (!value)
+				{
+					pc = instruction._operand;
+					continue;
+				}
+				break;
+			case GeometryInstruction::JUMP_IF_TRUE:
+				if (value)
+				{
+					pc = instruction._operand;
+					continue;
+				}
+				break;
+			case GeometryInstruction::IN_CELL:
+			case GeometryInstruction::NOT_IN_CELL:
+			{
+				int other = instruction._operand;
+				bool outside = true;
+				if (other != -1 && depth <= MAX_COMPLEMENT_DEPTH && _cells[other]._root != -1)
+					outside = !run(other, p, depth + 1);
+				value = (instruction._operation == GeometryInstruction::NOT_IN_CELL) ? outside : !outside;
+				break;
+			}
+		}
+		pc++;
+	}
+	return value;
+}
+
+// ==> isInside(cell, p)
+// Returns if the point is in the cell (index), every point of its universe is in a lattice
+//--------------------------------------------------------------------
+bool Geometry::isInside(int cell, const double p[3]) const
+{
+	if (_cells[cell]._latticeIndex != -1)
+		return true;
+	if (_cells[cell]._root == -1)
+		return false;
+	return run(cell, p, 0);
+}
+
+// ==> isInsideTree(cell, p)
+// Returns if the point is in the cell (index) by walking the node tree of its geometry, the compiled code must give
+// the same (i.e. to check the compiler)
+//--------------------------------------------------------------------
+bool Geometry::isInsideTree(int cell, const double p[3]) const
+{
+	if (_cells[cell]._latticeIndex != -1)
+		return true;
+	if (_cells[cell]._root == -1)
+		return false;
+	return evaluate(_cells[cell]._root, p, 0);
+}
+
+// ==> InsideTest
+// Exact test of the cells that the hierarchy finds for a point
+//--------------------------------------------------------------------
+struct InsideTest
+{
+	InsideTest(const Geometry* geometry, const double p[3]) : _geometry(geometry), _p(p) {}
+	bool operator()(int cell) const { return _geometry->isInside(cell, _p); }
+
+	const Geometry* _geometry;
+	const double* _p;
+};
+
+// ==> findCell(universe, p)
+// Returns the index of a cell of the universe that contains the point (-1 if there is none)
+// Only the bounded cells of which the box contains the point are tested (see BoundingVolumeHierarchy), then the
+// unbounded cells (in a valid geometry there is only one cell that contains the point)
+//--------------------------------------------------------------------
+int Geometry::findCell(int universe, const double p[3]) const
+{
+	const GeometryUniverse* cells = getUniverse(universe);
+	if (!cells)
+		return -1;
+	int cell = cells->_hierarchy.findFirst(p, InsideTest(this, p));
+	if (cell != -1)
+		return cell;
+	for (unsigned int i = 0; i < cells->_unboundedCells.size(); i++)
+		if (isInside(cells->_unboundedCells[i], p))
+			return cells->_unboundedCells[i];
+	return -1;
+}
+
+// ==> findCell(universe, x, y, z, count, cells, buffers)
+// The cells of the universe that contain the points (x[i], y[i], z[i]), like findCell for every point. A small universe
+// has its quadrics evaluated for all points at once with the vector kernels of the SurfaceStore, the senses are kept
+// as bits (64 points per word) and the trees of the cells are evaluated on the words, a cell for 64 points at a time.
+// A point that is in more than one cell (an overlap) gets the first one of the universe.
+//--------------------------------------------------------------------
+void Geometry::findCell(int universe, const double* x, const double* y, const double* z, int count, int* cells, SenseBuffers& buffers) const
+{
+	const GeometryUniverse* geometryUniverse = getUniverse(universe);
+	if (!geometryUniverse)
+	{
+		std::fill(cells, cells + count, -1);
+		return;
+	}
+	const std::vector<int>& quadrics = geometryUniverse->_quadrics;
+	if (count < MIN_BATCH_POINTS || quadrics.size() > MAX_BATCH_QUADRICS || geometryUniverse->_cells.size() > MAX_BATCH_CELLS)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			double p[3] = { x[i], y[i], z[i] };
+			cells[i] = findCell(universe, p);
+		}
+		return;
+	}
+
+	// the senses of the points against every quadric of the universe
+	int words = (count + 63)/64;
+	if ((int)buffers._rows.size() != _store.getCount())
+		buffers._rows.assign(_store.getCount(), -1);
+	buffers._wordCount = words;
+	buffers._senses.resize(count);
+	buffers._words.assign(quadrics.size()*words, 0);
+	for (unsigned int row = 0; row < quadrics.size(); row++)
+	{
+		buffers._rows[quadrics[row]] = row;
+		_store.sensePoints(quadrics[row], x, y, z, count, &buffers._senses[0]);
+		quint64* senses = &buffers._words[row*words];
+		for (int i = 0; i < count; i++)
+			senses[i >> 6] |= (quint64)buffers._senses[i] << (i & 63);
+	}
+
+	// the cells of the universe in order, every point gets the first cell that contains it
+	std::fill(cells, cells + count, -1);
+	const std::vector<int>& universeCells = geometryUniverse->_cells;
+	for (int word = 0; word < words; word++)
+	{
+		quint64 open = (word + 1 < words || (count & 63) == 0) ? ~(quint64)0 : ((quint64)1 << (count & 63)) - 1;
+		for (unsigned int n = 0; n < universeCells.size() && open != 0; n++)
+		{
+			const GeometryCell& cell = _cells[universeCells[n]];
+			quint64 inside;
+			if (cell._latticeIndex != -1)
+				inside = ~(quint64)0;
+			else if (cell._root == -1)
+				inside = 0;
+			else
+				inside = evaluateWord(cell._root, buffers, word, 0);
+			inside &= open;
+			open &= ~inside;
+			for (int i = 64*word; inside != 0; i++, inside >>= 1)
+				if (inside & 1)
+					cells[i] = universeCells[n];
+		}
+	}
+
+	for (unsigned int row = 0; row < quadrics.size(); row++)
+		buffers._rows[quadrics[row]] = -1;
+}
+
+// ==> evaluateWord(node, buffers, word, depth)
+// Returns the bits of the 64 points of the word (see findCell for many points) that are in the region of the node
+// (like evaluate, the senses are the ones of the buffers)
+//--------------------------------------------------------------------
+quint64 Geometry::evaluateWord(int node, const SenseBuffers& buffers, int word, int depth) const
+{
+	const GeometryNode& geometryNode = _nodes[node];
+	switch (geometryNode._type)
+	{
+		case GeometryNode::SURFACE:
+		{
+			const Surface& surface = _surfaces[geometryNode._index];
+			quint64 inside = ~(quint64)0;
+			int first = (geometryNode._facet == -1) ? 0 : geometryNode._facet;
+			int last = (geometryNode._facet == -1) ? surface._parts.size() : geometryNode._facet + 1;
+			for (int i = first; i < last; i++)
+			{
+				// only a complement nested deeper than MAX_COMPLEMENT_DEPTH has surfaces that the universe doesn't have
+				int row = buffers._rows[surface._first + i];
+				if (row != -1)
+					inside &= buffers._words[row*buffers._wordCount + word];
+			}
+			return geometryNode._negative ? inside : ~inside;
+		}
+		case GeometryNode::INTERSECTION:
+		{
+			quint64 value = ~(quint64)0;
+			for (unsigned int i = 0; i < geometryNode._children.size() && value != 0; i++)
+				value &= evaluateWord(geometryNode._children[i], buffers, word, depth);
+			return value;
+		}
+		case GeometryNode::UNION:
+		{
+			quint64 value = 0;
+			for (unsigned int i = 0; i < geometryNode._children.size() && value != ~(quint64)0; i++)
+				value |= evaluateWord(geometryNode._children[i], buffers, word, depth);
+			return value;
+		}
+		case GeometryNode::COMPLEMENT:
+			return ~evaluateWord(geometryNode._children[0], buffers, word, depth);
+		case GeometryNode::CELL:
+			if (geometryNode._index == -1 || depth > MAX_COMPLEMENT_DEPTH || _cells[geometryNode._index]._root == -1)
+				return ~(quint64)0;
+			return ~evaluateWord(_cells[geometryNode._index]._root, buffers, word, depth + 1);
+	}
+	return 0;
+}
+
+// ==> CollectTest
+// Keeps every cell that contains the point and lets the hierarchy go on (see findAllCells)
+//--------------------------------------------------------------------
+struct CollectTest
+{
+	CollectTest(const Geometry* geometry, const double p[3], std::vector<int>& cells) : _geometry(geometry), _p(p), _cells(cells) {}
+	bool operator()(int cell) const
+	{
+		if (_geometry->isInside(cell, _p))
+			_cells.push_back(cell);
+		return false;
+	}
+
+	const Geometry* _geometry;
+	const double* _p;
+	std::vector<int>& _cells;
+};
+
+// ==> findAllCells(universe, p, cells)
+// Append the indices of all cells of the universe that contain the point, not only the first one like findCell
+// (more than one is an overlap, none is a hole in the universe, see GeometryChecker)
+//--------------------------------------------------------------------
+void Geometry::findAllCells(int universe, const double p[3], std::vector<int>& cells) const
+{
+	const GeometryUniverse* geometryUniverse = getUniverse(universe);
+	if (!geometryUniverse)
+		return;
+	geometryUniverse->_hierarchy.findFirst(p, CollectTest(this, p, cells));
+	for (unsigned int i = 0; i < geometryUniverse->_unboundedCells.size(); i++)
+		if (isInside(geometryUniverse->_unboundedCells[i], p))
+			cells.push_back(geometryUniverse->_unboundedCells[i]);
+}
+
+// ==> findCells(universe, o, d, tMin, tMax, cells)
+// Append the indices of the cells of the universe that the ray o + t d can cross between tMin and tMax:
+// the bounded cells of which the box is crossed and all the unbounded cells
+//--------------------------------------------------------------------
+void Geometry::findCells(int universe, const double o[3], const double d[3], double tMin, double tMax, std::vector<int>& cells) const
+{
+	const GeometryUniverse* geometryUniverse = getUniverse(universe);
+	if (!geometryUniverse)
+		return;
+	geometryUniverse->_hierarchy.findItems(o, d, tMin, tMax, cells);
+	cells.insert(cells.end(), geometryUniverse->_unboundedCells.begin(), geometryUniverse->_unboundedCells.end());
+}
+
+// ==> locate(p)
+// Returns the index of the deepest cell that contains the point of the real world (see SlicePlotter::classify)
+// A filled cell passes the point on to its universe, -1 if there is no cell or the universe has no cell there
+//--------------------------------------------------------------------
+int Geometry::locate(const double p[3]) const
+{
+	double q[3] = { p[0], p[1], p[2] };
+	int cell = findCell(0, q);
+	for (int depth = 0; cell != -1 && depth < MAX_UNIVERSE_DEPTH; depth++)
+	{
+		Transformation transformation;
+		int universe = getFilling(cell, q, transformation);
+		if (universe == -1)
+			break;
+		transformation.apply(q, q);
+		cell = findCell(universe, q);
+	}
+	return cell;
+}
+
+// ==> locate(x, y, z, count, cells, buffers, labels)
+// The deepest cells that contain the points of the real world, like locate for every point: the points are found in a
+// universe together (see findCell for many points) and go down into the universes of their filled cells in groups
+// The label of a point starts as its cell of the real world, every filled cell adds its element (see getFilling) and
+// then the cell of its universe (see SlicePlotter::classify, which must label the points the same way)
+//--------------------------------------------------------------------
+void Geometry::locate(const double* x, const double* y, const double* z, int count, int* cells, SenseBuffers& buffers, int* labels) const
+{
+	findCell(0, x, y, z, count, cells, buffers);
+	std::vector<double> q(3*count);
+	std::vector<int> points;
+	for (int i = 0; i < count; i++)
+	{
+		q[3*i] = x[i];
+		q[3*i + 1] = y[i];
+		q[3*i + 2] = z[i];
+		if (labels)
+			labels[i] = cells[i];
+		if (cells[i] != -1)
+			points.push_back(i);
+	}
+
+	std::vector<double> groupX, groupY, groupZ;
+	std::vector<int> groupCells;
+	for (int depth = 0; depth < MAX_UNIVERSE_DEPTH && !points.empty(); depth++)
+	{
+		// the points in every universe (in its coordinates)
+		std::map<int, std::vector<int> > groups;
+		for (unsigned int n = 0; n < points.size(); n++)
+		{
+			int i = points[n];
+			Transformation transformation;
+			int element;
+			int universe = getFilling(cells[i], &q[3*i], transformation, &element);
+			if (labels && isFilled(cells[i]))
+				labels[i] = getLabel(labels[i], element);
+			if (universe == -1)
+				continue;
+			transformation.apply(&q[3*i], &q[3*i]);
+			groups[universe].push_back(i);
+		}
+
+		points.clear();
+		std::map<int, std::vector<int> >::const_iterator iter;
+		for (iter = groups.begin(); iter != groups.end(); ++iter)
+		{
+			const std::vector<int>& group = iter->second;
+			int size = group.size();
+			groupX.resize(size);
+			groupY.resize(size);
+			groupZ.resize(size);
+			groupCells.resize(size);
+			for (int n = 0; n < size; n++)
+			{
+				groupX[n] = q[3*group[n]];
+				groupY[n] = q[3*group[n] + 1];
+				groupZ[n] = q[3*group[n] + 2];
+			}
+			findCell(iter->first, &groupX[0], &groupY[0], &groupZ[0], size, &groupCells[0], buffers);
+			for (int n = 0; n < size; n++)
+			{
+				cells[group[n]] = groupCells[n];
+				if (labels)
+					labels[group[n]] = getLabel(labels[group[n]], groupCells[n]);
+				if (groupCells[n] != -1)
+					points.push_back(group[n]);
+			}
+		}
+	}
+}
+
+// ==> getBounds()
+// Bounds of the cells of the real world (universe 0) without the outside world (imp:n=0), infinite if one of them
+// has no finite bounds
+//--------------------------------------------------------------------
+Box Geometry::getBounds() const
+{
+	Box bounds;
+	const GeometryUniverse* universe = getUniverse(0);
+	if (!universe)
+		return bounds;
+	for (unsigned int i = 0; i < universe->_cells.size(); i++)
+		if (!_cells[universe->_cells[i]]._imp0)
+			bounds.grow(_cells[universe->_cells[i]]._box);
+	return bounds;
+}
+
+//####################################################################
+//#  LATTICES
+//####################################################################
+
+// ==> singleAxis(v)
+// Returns the axis of the only component of the vector that is not zero (-1 if there is none or more than one)
+//--------------------------------------------------------------------
+static int singleAxis(const double v[3])
+{
+	int axis = -1;
+	for (int i = 0; i < 3; i++)
+	{
+		if (v[i] == 0.0)
+			continue;
+		if (axis != -1)
+			return -1;
+		axis = i;
+	}
+	return axis;
+}
+
+// ==> toIndex(x)
+// Index of an element from its (fractional) index, kept within the range of an int
+//--------------------------------------------------------------------
+static int toIndex(double x)
+{
+	return (int)std::max(-1e9, std::min(1e9, std::floor(x)));
+}
+
+// ==> addElementSlab(lattice, normal, center, width)
+// Add a slab |normal.p - center| <= width to the shape of the element (0, 0, 0) of the lattice
+//--------------------------------------------------------------------
+static void addElementSlab(GeometryLattice& lattice, const double normal[3], double center, double width)
+{
+	int slab = lattice._slabCount++;
+	for (int i = 0; i < 3; i++)
+		lattice._slabNormals[slab][i] = normal[i];
+	lattice._slabCenters[slab] = center;
+	lattice._slabWidths[slab] = width;
+}
+
+// ==> createLattice(type, shape, lattice)
+// Set the translations and the shape of the elements of the lattice from the shape of the element (0, 0, 0)
+//		LAT=1: minX minY minZ maxX maxY maxZ of the box (see MCNPXParser.getRectangularOffset), the elements repeat
+//			   along the axes with the width of the box, an axis without bounds has only one element
+//		LAT=2: base, height and side vector of the hexagonal prism (see MCNPXParser.getHexOffset): the pitch b is
+//			   twice the side vector, the elements across the side vector are 1.5 times the side of the hexagon
+//			   apart and shifted over b/2, the height and the side vector must be along an axis
+// Returns false if the shape doesn't define the elements
+//--------------------------------------------------------------------
+bool Geometry::createLattice(int type, const std::vector<double>& shape, GeometryLattice& lattice)
+{
+	lattice._type = type;
+	lattice._slabCount = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		lattice._origin[i] = 0.0;
+		lattice._hexAxes[i] = -1;
+		for (int j = 0; j < 3; j++)
+			lattice._steps[i][j] = 0.0;
+	}
+
+	if (type == 1)
+	{
+		if (shape.size() != 6)
+			return false;
+		for (int i = 0; i < 3; i++)
+		{
+			double min = shape[i];
+			double max = shape[i + 3];
+			if (std::fabs(min) == std::numeric_limits<double>::infinity() || std::fabs(max) == std::numeric_limits<double>::infinity())
+				continue;
+			if (max <= min)
+				return false;
+			double normal[3] = { 0.0, 0.0, 0.0 };
+			normal[i] = 1.0;
+			lattice._origin[i] = min;
+			lattice._steps[i][i] = max - min;
+			addElementSlab(lattice, normal, 0.5*(min + max), 0.5*(max - min));
+		}
+		return true;
+	}
+
+	if (type == 2)
+	{
+		if (shape.size() != 9)
+			return false;
+		const double* base = &shape[0];
+		const double* height = &shape[3];
+		const double* side = &shape[6];
+		int sideAxis = singleAxis(side);
+		int heightAxis = singleAxis(height);
+		if (sideAxis == -1 || heightAxis == -1 || sideAxis == heightAxis)
+			return false;
+		int acrossAxis = 3 - sideAxis - heightAxis;
+
+		double pitch = 2.0*std::fabs(side[sideAxis]);
+		double a = pitch/std::sqrt(3.0);
+		lattice._steps[sideAxis][sideAxis] = pitch;
+		lattice._steps[acrossAxis][acrossAxis] = 1.5*a;
+		lattice._steps[acrossAxis][sideAxis] = 0.5*pitch;
+		lattice._steps[heightAxis][heightAxis] = height[heightAxis];
+		for (int i = 0; i < 3; i++)
+			lattice._origin[i] = base[i];
+		lattice._hexAxes[0] = sideAxis;
+		lattice._hexAxes[1] = acrossAxis;
+		lattice._hexAxes[2] = heightAxis;
+
+		// the facets of the hexagon face the side vector and the directions 60 degrees from it
+		double cosines[3] = { 1.0, 0.5, -0.5 };
+		for (int n = 0; n < 3; n++)
+		{
+			double normal[3] = { 0.0, 0.0, 0.0 };
+			normal[sideAxis] = cosines[n];
+			normal[acrossAxis] = (n == 0) ? 0.0 : 0.5*std::sqrt(3.0);
+			addElementSlab(lattice, normal, normal[sideAxis]*base[sideAxis] + normal[acrossAxis]*base[acrossAxis], 0.5*pitch);
+		}
+		double normal[3] = { 0.0, 0.0, 0.0 };
+		normal[heightAxis] = 1.0;
+		addElementSlab(lattice, normal, base[heightAxis] + 0.5*height[heightAxis], 0.5*std::fabs(height[heightAxis]));
+		return true;
+	}
+	return false;
+}
+
+// ==> locateElement(lattice, p, index)
+// Index of the element of the lattice that contains the point, from the pitch and origin (no element is tested)
+// The hexagonal elements are found by rounding the fractional indices to the nearest center in cube coordinates
+//--------------------------------------------------------------------
+void Geometry::locateElement(const GeometryLattice& lattice, const double p[3], int index[3]) const
+{
+	if (lattice._type == 1)
+	{
+		for (int i = 0; i < 3; i++)
+			index[i] = (lattice._steps[i][i] > 0.0) ? toIndex((p[i] - lattice._origin[i])/lattice._steps[i][i]) : 0;
+		return;
+	}
+
+	int side = lattice._hexAxes[0];
+	int across = lattice._hexAxes[1];
+	int height = lattice._hexAxes[2];
+	index[height] = toIndex((p[height] - lattice._origin[height])/lattice._steps[height][height]);
+
+	double r = (p[across] - lattice._origin[across])/lattice._steps[across][across];
+	double q = (p[side] - lattice._origin[side] - r*lattice._steps[across][side])/lattice._steps[side][side];
+	double s = -q - r;
+	double roundQ = std::floor(q + 0.5);
+	double roundR = std::floor(r + 0.5);
+	double roundS = std::floor(s + 0.5);
+	double errorQ = std::fabs(roundQ - q);
+	double errorR = std::fabs(roundR - r);
+	double errorS = std::fabs(roundS - s);
+	if (errorQ > errorR && errorQ > errorS)
+		roundQ = -roundR - roundS;
+	else if (errorR > errorS)
+		roundR = -roundQ - roundS;
+	index[side] = toIndex(roundQ);
+	index[across] = toIndex(roundR);
+}
+
+// ==> getFilling(cell, p, transformation, element)
+// Returns the universe that fills the cell at the point and the transformation from the coordinates of the cell to the
+// coordinates of that universe: the TRCL of the cell (back to where the cell was before it was moved), then the
+// translation of a lattice element to the element 0 and then the FILL transformation
+// The universe of a lattice element comes from the FILL array (i runs fastest), an axis with the range 0:0 repeats the
+// universes of its element 0 and a FILL array that is too short repeats itself (like the layers of MCNPXParser.buildLattice)
+// Returns -1 if the cell is not filled there: no fill, or a lattice element that is the lattice cell itself (filled with
+// the universe of the lattice) or that is outside the FILL ranges
+// The number of an element is a hash of its indices (a different prime per axis)
+//--------------------------------------------------------------------
+int Geometry::getFilling(int cell, const double p[3], Transformation& transformation, int* element) const
+{
+	const GeometryCell& geometryCell = _cells[cell];
+	if (element)
+		*element = 0;
+	if (geometryCell._latticeIndex == -1)
+	{
+		if (geometryCell._fill == 0)
+			return -1;
+		if (geometryCell._trcl == -1)
+			transformation = (geometryCell._transformation != -1) ? _transformations.get(geometryCell._transformation) : Transformation();
+		else if (geometryCell._transformation == -1)
+			transformation = _transformations.get(geometryCell._trcl);
+		else
+			transformation = _transformations.get(geometryCell._transformation).compose(_transformations.get(geometryCell._trcl));
+		return geometryCell._fill;
+	}
+
+	const GeometryLattice& lattice = _lattices[geometryCell._latticeIndex];
+	if (lattice._universes.empty())
+		return -1;
+	double q[3] = { p[0], p[1], p[2] };
+	if (geometryCell._trcl != -1)
+		_transformations.get(geometryCell._trcl).apply(p, q);
+	int index[3];
+	locateElement(lattice, q, index);
+	if (element)
+		*element = (int)(73856093u*(unsigned int)index[0] ^ 19349663u*(unsigned int)index[1] ^ 83492791u*(unsigned int)index[2]);
+
+	int position = 0;
+	int size = 1;
+	for (int i = 0; i < 3; i++)
+	{
+		int first = lattice._range[i][0];
+		int last = lattice._range[i][1];
+		int n = (first == 0 && last == 0) ? 0 : index[i];
+		if (n < first || n > last)
+			return -1;
+		position += (n - first)*size;
+		size *= last - first + 1;
+	}
+	int universe = lattice._universes[position % lattice._universes.size()];
+	if (universe == geometryCell._universe)
+		return -1;
+
+	double offset[3] = { 0.0, 0.0, 0.0 };
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			offset[j] -= index[i]*lattice._steps[i][j];
+	transformation = Transformation::translation(offset);
+	if (geometryCell._trcl != -1)
+		transformation = transformation.compose(_transformations.get(geometryCell._trcl));
+	if (geometryCell._transformation != -1)
+		transformation = _transformations.get(geometryCell._transformation).compose(transformation);
+	return universe;
+}
+
+// ==> getElementExit(cell, p, d, normal)
+// Returns the distance along d from p to where the ray leaves the lattice element of p (the nearest slab of the
+// shape of the element that the ray leaves) and the normal of that slab, infinite if the cell is no lattice
+// The elements are found in the coordinates of the cell before its TRCL (the distances stay the same)
+//--------------------------------------------------------------------
+double Geometry::getElementExit(int cell, const double point[3], const double direction[3], double normal[3]) const
+{
+	double exit = std::numeric_limits<double>::infinity();
+	if (_cells[cell]._latticeIndex == -1)
+		return exit;
+
+	double p[3] = { point[0], point[1], point[2] };
+	double d[3] = { direction[0], direction[1], direction[2] };
+	const Transformation* trcl = (_cells[cell]._trcl != -1) ? &_transformations.get(_cells[cell]._trcl) : 0;
+	if (trcl)
+	{
+		trcl->apply(point, p);
+		trcl->rotate(direction, d);
+	}
+
+	const GeometryLattice& lattice = _lattices[_cells[cell]._latticeIndex];
+	int index[3];
+	locateElement(lattice, p, index);
+	double offset[3] = { 0.0, 0.0, 0.0 };
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			offset[j] += index[i]*lattice._steps[i][j];
+
+	for (int n = 0; n < lattice._slabCount; n++)
+	{
+		const double* slabNormal = lattice._slabNormals[n];
+		double distance = 0.0;
+		double speed = 0.0;
+		for (int i = 0; i < 3; i++)
+		{
+			distance += slabNormal[i]*(p[i] - offset[i]);
+			speed += slabNormal[i]*d[i];
+		}
+		distance -= lattice._slabCenters[n];
+		double t;
+		if (speed > 0.0)
+			t = (lattice._slabWidths[n] - distance)/speed;
+		else if (speed < 0.0)
+			t = (-lattice._slabWidths[n] - distance)/speed;
+		else
+			continue;
+		if (t < exit)
+		{
+			exit = t;
+			for (int i = 0; i < 3; i++)
+				normal[i] = (speed > 0.0) ? slabNormal[i] : -slabNormal[i];
+		}
+	}
+	if (trcl && exit != std::numeric_limits<double>::infinity())
+		trcl->rotateInverse(normal, normal);
+	return std::max(exit, 0.0);
+}
+
+//####################################################################
+//#  COMPILER
+//####################################################################
+
+// ==> radicalInverse(i, base)
+// The i-th number of the van der Corput sequence in the base (the coordinates of the Halton points)
+//--------------------------------------------------------------------
+static double radicalInverse(int i, int base)
+{
+	double result = 0.0;
+	double digit = 1.0/base;
+	for (; i > 0; i /= base, digit /= base)
+		result += (i % base)*digit;
+	return result;
+}
+
+// ==> OperandOrder
+// Order of the operands of an intersection (or union) with the least expected cost: by the cost of an operand
+// divided by the chance that it decides the result (that it is false for an intersection, true for a union)
+//--------------------------------------------------------------------
+struct OperandOrder
+{
+	OperandOrder(const std::vector<double>& costs, const std::vector<double>& decisive) : _costs(costs), _decisive(decisive) {}
+	bool operator()(int operand1, int operand2) const
+	{
+		return _costs[operand1]*_decisive[operand2] < _costs[operand2]*_decisive[operand1];
+	}
+
+	const std::vector<double>& _costs;
+	const std::vector<double>& _decisive;
+};
+
+// ==> compileCells()
+// Compile the geometry tree of every cell, the operands are ordered by the chance that they are true at the Halton
+// points in the bounds of the cell (the points that the hierarchy passes on to the cell). The jumps to a jump go on to
+// its target (same condition) or to the instruction after it (opposite condition).
+//--------------------------------------------------------------------
+void Geometry::compileCells()
+{
+	_code.clear();
+	std::vector<GeometryInstruction> code;
+	std::vector<double> samples;
+	for (unsigned int n = 0; n < _cells.size(); n++)
+	{
+		GeometryCell& cell = _cells[n];
+		cell._code = _code.size();
+		cell._codeSize = 0;
+		if (cell._root == -1)
+			continue;
+
+		samples.clear();
+		if (cell._box.isFinite())
+		{
+			for (int i = 1; i <= COMPILE_SAMPLES; i++)
+			{
+				double u[3] = { radicalInverse(i, 2), radicalInverse(i, 3), radicalInverse(i, 5) };
+				for (int j = 0; j < 3; j++)
+					samples.push_back(cell._box._min[j] + u[j]*(cell._box._max[j] - cell._box._min[j]));
+			}
+		}
+
+		code.clear();
+		double probability;
+		compileNode(cell._root, false, samples, code, probability);
+
+		for (unsigned int i = 0; i < code.size(); i++)
+		{
+			GeometryInstruction& jump = code[i];
+			if (jump._operation != GeometryInstruction::JUMP_IF_FALSE && jump._operation != GeometryInstruction::JUMP_IF_TRUE)
+				continue;
+			while (jump._operand < (int)code.size())
+			{
+				const GeometryInstruction& target = code[jump._operand];
+				if (target._operation == jump._operation)
+					jump._operand = target._operand;
+				else if (target._operation == GeometryInstruction::JUMP_IF_FALSE || target._operation == GeometryInstruction::JUMP_IF_TRUE)
+					jump._operand++;
+				else
+					break;
+			}
+		}
+
+		_code.insert(_code.end(), code.begin(), code.end());
+		cell._codeSize = code.size();
+	}
+}
+
+// ==> compileNode(node, negated, samples, code, probability)
+// Append the code of the region of the node (or of its complement if negated) to code, the jumps go to an index in code
+// Returns the expected number of quadrics that the code evaluates, probability is the chance that the result is true
+//--------------------------------------------------------------------
+double Geometry::compileNode(int node, bool negated, const std::vector<double>& samples, std::vector<GeometryInstruction>& code, double& probability) const
+{
+	const GeometryNode& geometryNode = _nodes[node];
+	switch (geometryNode._type)
+	{
+		case GeometryNode::SURFACE:
+		{
+			const Surface& surface = _surfaces[geometryNode._index];
+			bool inside = geometryNode._negative != negated;
+			GeometryInstruction::Operation test = inside ? GeometryInstruction::INSIDE : GeometryInstruction::OUTSIDE;
+			probability = estimateProbability(node, negated, samples);
+			if (geometryNode._facet != -1 || surface._parts.size() == 1)
+			{
+				code.push_back(GeometryInstruction(test, surface._first + std::max(geometryNode._facet, 0)));
+				return 1.0;
+			}
+
+			// the inside of all the parts of a macrobody or the outside of one of them
+			std::vector<int> jumps;
+			for (unsigned int i = 0; i < surface._parts.size(); i++)
+			{
+				if (i > 0)
+				{
+					jumps.push_back(code.size());
+					code.push_back(GeometryInstruction(inside ? GeometryInstruction::JUMP_IF_FALSE : GeometryInstruction::JUMP_IF_TRUE));
+				}
+				code.push_back(GeometryInstruction(test, surface._first + i));
+			}
+			for (unsigned int i = 0; i < jumps.size(); i++)
+				code[jumps[i]]._operand = code.size();
+			return surface._parts.size();
+		}
+		case GeometryNode::INTERSECTION:
+		case GeometryNode::UNION:
+		{
+			// a negated intersection is the union of the negated operands and vice versa
+			bool intersection = (geometryNode._type == GeometryNode::INTERSECTION) != negated;
+			int count = geometryNode._children.size();
+			std::vector<std::vector<GeometryInstruction> > operands(count);
+			std::vector<double> costs(count);
+			std::vector<double> decisive(count);
+			std::vector<int> order(count);
+			for (int i = 0; i < count; i++)
+			{
+				double operandProbability;
+				costs[i] = compileNode(geometryNode._children[i], negated, samples, operands[i], operandProbability);
+				decisive[i] = intersection ? 1.0 - operandProbability : operandProbability;
+				order[i] = i;
+			}
+			std::stable_sort(order.begin(), order.end(), OperandOrder(costs, decisive));
+
+			double cost = 0.0;
+			double reached = 1.0;
+			std::vector<int> jumps;
+			for (int i = 0; i < count; i++)
+			{
+				if (i > 0)
+				{
+					jumps.push_back(code.size());
+					code.push_back(GeometryInstruction(intersection ? GeometryInstruction::JUMP_IF_FALSE : GeometryInstruction::JUMP_IF_TRUE));
+				}
+				const std::vector<GeometryInstruction>& operand = operands[order[i]];
+				int offset = code.size();
+				for (unsigned int j = 0; j < operand.size(); j++)
+				{
+					code.push_back(operand[j]);
+					if (operand[j]._operation == GeometryInstruction::JUMP_IF_FALSE || operand[j]._operation == GeometryInstruction::JUMP_IF_TRUE)
+						code.back()._operand += offset;
+				}
+				cost += reached*costs[order[i]];
+				reached *= 1.0 - decisive[order[i]];
+			}
+			for (unsigned int i = 0; i < jumps.size(); i++)
+				code[jumps[i]]._operand = code.size();
+			probability = estimateProbability(node, negated, samples);
+			return cost;
+		}
+		case GeometryNode::COMPLEMENT:
+			return compileNode(geometryNode._children[0], !negated, samples, code, probability);
+		case GeometryNode::CELL:
+		{
+			code.push_back(GeometryInstruction(negated ? GeometryInstruction::IN_CELL : GeometryInstruction::NOT_IN_CELL, geometryNode._index));
+			probability = estimateProbability(node, negated, samples);
+			if (geometryNode._index == -1)
+				return 1.0;
+			return std::max((int)_cells[geometryNode._index]._surfaces.size(), 1);
+		}
+	}
+	probability = 0.5;
+	return 1.0;
+}
+
+// ==> estimateProbability(node, negated, samples)
+// Chance that a point is in the region of the node (or in its complement if negated), from the fraction of the samples
+// in it (a half sample is added to both sides, so no operand is taken as always or never true), 0.5 without samples
+//--------------------------------------------------------------------
+double Geometry::estimateProbability(int node, bool negated, const std::vector<double>& samples) const
+{
+	int count = samples.size()/3;
+	int inside = 0;
+	for (int i = 0; i < count; i++)
+		if (evaluate(node, &samples[3*i], 0) != negated)
+			inside++;
+	return (inside + 0.5)/(count + 1.0);
+}
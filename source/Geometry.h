@@ -0,0 +1,261 @@
+//#########################################################################################################
+//## Geometry.h
+//#########################################################################################################
+//##
+//## Native representation of the surfaces and cells of a mcnpx file (written by MCNPXPreParser.py)
+//## Every surface is reduced to general quadrics (the coefficients of a GQ card), a macrobody to the
+//## intersection of its facets. The geometry of a cell is kept as a tree of surface senses, intersections,
+//## unions and complements, so the GUI can find the cell of a point itself (i.e. for the RayCaster)
+//## The tree of every cell is compiled once to a list of instructions (see GeometryInstruction), which is
+//## what the point in cell tests run. The TR cards are resolved once to affine maps (see Transformation):
+//## the surfaces of a TR card and the cells of a TRCL are moved when they are loaded, a FILL transformation
+//## is applied to the points that go into the universe (after the TRCL, which moves the filling with the cell).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <QString>
+#include <QStringList>
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+#include "BoundingVolumeHierarchy.h"
+#include "SurfaceStore.h"
+#include "Transformation.h"
+
+// Ax^2 + By^2 + Cz^2 + Dxy + Eyz + Fzx + Gx + Hy + Jz + K, the inside (negative sense) is where it is negative
+struct Quadric
+{
+	public:
+		Quadric();
+
+		// the half space n.p - d < 0
+		static Quadric plane(double nx, double ny, double nz, double d);
+		// p^T M p + L.p + K (M symmetric)
+		static Quadric fromMatrix(const double m[3][3], const double l[3], double k);
+
+		// Move the quadric over c: Q(p - c)
+		void translate(const double c[3]);
+		// Substitute an affine map: Q(R p + b)
+		void transform(const double r[3][3], const double b[3]);
+
+		double evaluate(const double p[3]) const;
+		void gradient(const double p[3], double n[3]) const;
+		// Roots of Q(o + t d), returns the number of roots (0, 1 or 2, sorted)
+		int intersect(const double o[3], const double d[3], double t[2]) const;
+
+		double _c[10];	// A, B, C, D, E, F, G, H, J, K
+};
+
+// A surface card: the intersection of its parts (one part for a simple surface, the facets of a macrobody)
+struct Surface
+{
+	public:
+		Surface(int number = 0) : _number(number), _first(-1) {}
+
+		// the largest value of the parts: negative if the point is inside all of them
+		double evaluate(const double p[3]) const
+		{
+			double value = _parts[0].evaluate(p);
+			for (unsigned int i = 1; i < _parts.size(); i++)
+			{
+				double partValue = _parts[i].evaluate(p);
+				if (partValue > value)
+					value = partValue;
+			}
+			return value;
+		}
+
+		int _number;
+		std::vector<Quadric> _parts;
+		int _first;		// index of the first part in the SurfaceStore of the geometry
+};
+
+// A node of the geometry tree of a cell
+struct GeometryNode
+{
+	enum Type { SURFACE, INTERSECTION, UNION, COMPLEMENT, CELL };
+
+	Type _type;
+	int _index;						// SURFACE: index of the surface, CELL (#n): index of the complemented cell
+	int _facet;						// SURFACE: index of the part of a macrobody (-1 for the whole surface)
+	bool _negative;					// SURFACE: the node is the inside (negative sense) of the surface
+	std::vector<int> _children;		// INTERSECTION, UNION and COMPLEMENT: indices of the operand nodes
+};
+
+// An instruction of the compiled geometry of a cell, the code is postfix: the operands of an intersection or
+// union come first, each one followed by a jump that skips the remaining operands once the result is decided.
+// Complements are pushed down to the surfaces (De Morgan), so the code needs only one value: the last test.
+struct GeometryInstruction
+{
+	enum Operation { INSIDE, OUTSIDE, JUMP_IF_FALSE, JUMP_IF_TRUE, IN_CELL, NOT_IN_CELL };
+
+	GeometryInstruction(Operation operation = INSIDE, int operand = 0) : _operation(operation), _operand(operand) {}
+
+	int _operation;
+	int _operand;		// INSIDE and OUTSIDE: index of the quadric in the SurfaceStore, jumps: index of the next instruction
+						// (from the start of the code of the cell), IN_CELL and NOT_IN_CELL: index of the cell (-1 if not known)
+};
+
+// The elements of a LAT=1 or LAT=2 cell (see MCNPXParser.buildLattice): element (i, j, k) is the cell moved over
+// i _steps[0] + j _steps[1] + k _steps[2] and filled with a universe of the FILL array
+struct GeometryLattice
+{
+	int _type;
+	int _range[3][2];				// FILL ranges of i, j and k
+	std::vector<int> _universes;	// universes of the FILL array (i runs fastest)
+	double _steps[3][3];			// translation of the elements per index
+	double _origin[3];				// LAT=1: lower corner of the element (0, 0, 0), LAT=2: base of its hexagonal prism
+	int _hexAxes[3];				// LAT=2: axis of the side vector, the axis across it and the axis of the height
+	// the element (0, 0, 0) is where |n.p - c| <= w for the normal n, center c and half width w of every slab
+	int _slabCount;
+	double _slabNormals[4][3];
+	double _slabCenters[4];
+	double _slabWidths[4];
+};
+
+// A cell card
+struct GeometryCell
+{
+	int _number;
+	int _material;
+	int _universe;			// universe the cell belongs to (0 is the real world)
+	int _fill;				// universe that fills the cell (0 if not filled)
+	int _lattice;			// type of the lattice (0 if the cell is no lattice)
+	int _latticeIndex;		// index of the elements of the lattice in the geometry (-1 if they are not known)
+	int _transformation;	// index of the FILL transformation in the TransformationTable (-1 if there is none)
+	int _trcl;				// index of the TRCL transformation in the TransformationTable (-1 if there is none), it
+							// takes a point to the coordinates of the cell before it was moved (where its filling is)
+	bool _imp0;				// the cell has imp:n=0 (outside world)
+	int _root;				// index of the root node of the geometry (-1 if it couldn't be parsed)
+	int _code;				// index of the first instruction of the compiled geometry
+	int _codeSize;			// number of instructions of the compiled geometry
+	QString _geometry;
+	Box _box;				// bounds of the cell (infinite if they couldn't be found, empty if the cell is empty)
+	std::vector<int> _surfaces;	// surfaces that the geometry uses (including the ones of the complemented cells)
+};
+
+// The cells of a universe and the surfaces that they use
+struct GeometryUniverse
+{
+	std::vector<int> _cells;
+	std::vector<int> _surfaces;
+	std::vector<int> _quadrics;				// the parts of the surfaces (indices in the SurfaceStore)
+	BoundingVolumeHierarchy _hierarchy;		// over the cells with finite bounds
+	std::vector<int> _unboundedCells;		// cells without finite bounds (tested after the hierarchy)
+};
+
+// Work space of the tests of many points at once (see Geometry::findCell), one per thread
+struct SenseBuffers
+{
+	SenseBuffers() : _wordCount(0) {}
+
+	std::vector<int> _rows;					// row of every quadric of the SurfaceStore in _words (-1 if it has none)
+	std::vector<unsigned char> _senses;		// the senses of the points against one quadric
+	std::vector<quint64> _words;			// the senses of the points against the quadrics of a universe: a row per
+											// quadric of _wordCount words, a bit per point
+	int _wordCount;
+};
+
+class Geometry
+{
+	public:
+		Geometry();
+		~Geometry();
+
+		// Load the geometry file written by MCNPXPreParser.py (replaces the current geometry)
+		bool load(QString fileName);
+		void clear();
+		bool isEmpty() const { return _cells.empty(); }
+		// Hash of the loaded geometry file (i.e. for the key of a VoxelGrid cache)
+		QString getHash() const { return _hash; }
+		// Bounds of the cells of the real world without the outside world (imp:n=0)
+		Box getBounds() const;
+
+		int getSurfaceCount() const { return _surfaces.size(); }
+		const Surface& getSurface(int index) const { return _surfaces[index]; }
+		int getCellCount() const { return _cells.size(); }
+		const GeometryCell& getCell(int index) const { return _cells[index]; }
+		// Returns the cells and surfaces of a universe (0 if the universe is not known)
+		const GeometryUniverse* getUniverse(int universe) const;
+
+		// Returns if the point is in the cell (index)
+		bool isInside(int cell, const double p[3]) const;
+		// The same by walking the node tree of the geometry of the cell instead of running its compiled code
+		bool isInsideTree(int cell, const double p[3]) const;
+		// Returns the index of a cell of the universe that contains the point (-1 if there is none)
+		int findCell(int universe, const double p[3]) const;
+		// The same for count points (x[i], y[i], z[i]) at once
+		void findCell(int universe, const double* x, const double* y, const double* z, int count, int* cells, SenseBuffers& buffers) const;
+		// Append the indices of all cells of the universe that contain the point
+		void findAllCells(int universe, const double p[3], std::vector<int>& cells) const;
+		// Append the indices of the cells of the universe that the ray o + t d can cross between tMin and tMax
+		void findCells(int universe, const double o[3], const double d[3], double tMin, double tMax, std::vector<int>& cells) const;
+		// Returns the index of the deepest cell that contains the point of the real world, through the filled cells and
+		// lattice elements (-1 if there is none, also if the universe of a filled cell has no cell there)
+		int locate(const double p[3]) const;
+		// The same for count points at once, grouped by the universe that they go into
+		// labels (optional) gets a label of the path of every point, which differs between the copies of a cell in other
+		// lattice elements or other filled cells (-1 if there is no cell, see getLabel)
+		void locate(const double* x, const double* y, const double* z, int count, int* cells, SenseBuffers& buffers, int* labels = 0) const;
+		// Extends the label of a path with the next cell or the element of a lattice
+		static int getLabel(int label, int value)
+		{
+			unsigned int hash = (unsigned int)label;
+			return (int)(hash ^ ((unsigned int)value + 0x9e3779b9u + (hash << 6) + (hash >> 2)));
+		}
+
+		// Returns if the cell is filled with a universe or is a lattice of which the elements are known
+		bool isFilled(int cell) const { return _cells[cell]._fill != 0 || _cells[cell]._latticeIndex != -1; }
+		// Returns the universe that fills the cell at the point and the transformation from the coordinates of the cell
+		// to the coordinates of that universe (the TRCL of the cell, the element of a lattice and the FILL transformation)
+		// Returns -1 if the cell is not filled there: no fill, or a lattice element that is the lattice cell itself
+		// (filled with the universe of the lattice) or that is outside the FILL ranges
+		// element (optional) gets a number of the lattice element of the point, which differs between neighbouring
+		// elements (also where they are not filled, 0 if the cell is no lattice)
+		int getFilling(int cell, const double p[3], Transformation& transformation, int* element = 0) const;
+		// Returns the distance along d from p to where the ray leaves the lattice element of p and the normal there
+		// (infinite if the cell is no lattice)
+		double getElementExit(int cell, const double p[3], const double d[3], double normal[3]) const;
+
+	private:
+		bool createSurface(QString mnemonic, const std::vector<double>& data, Surface& surface);
+		bool createLattice(int type, const std::vector<double>& shape, GeometryLattice& lattice);
+		void locateElement(const GeometryLattice& lattice, const double p[3], int index[3]) const;
+		void transformSurface(Surface& surface, const Transformation& transformation);
+		void moveCell(int cell, const Transformation& transformation);
+		void moveNode(int node, const Transformation& transformation, std::map<int, int>& moved, int number);
+		int parseUnion(const QStringList& tokens, int& pos);
+		int parseIntersection(const QStringList& tokens, int& pos);
+		int parseFactor(const QStringList& tokens, int& pos);
+		int addNode(GeometryNode::Type type);
+		void collectSurfaces(int node, std::vector<int>& marks, int mark, std::vector<int>& surfaces, int depth) const;
+		bool bound(int node, Box& box, int depth) const;
+		void buildHierarchies();
+		bool evaluate(int node, const double p[3], int depth) const;
+		void compileCells();
+		double compileNode(int node, bool negated, const std::vector<double>& samples, std::vector<GeometryInstruction>& code, double& probability) const;
+		double estimateProbability(int node, bool negated, const std::vector<double>& samples) const;
+		bool run(int cell, const double p[3], int depth) const;
+		quint64 evaluateWord(int node, const SenseBuffers& buffers, int word, int depth) const;
+
+		std::vector<Surface> _surfaces;
+		std::map<int, int> _surfaceIndex;		// surface number => index in _surfaces
+		SurfaceStore _store;
+		std::vector<GeometryCell> _cells;
+		std::map<int, int> _cellIndex;			// cell number => index in _cells
+		std::vector<GeometryNode> _nodes;
+		std::vector<GeometryInstruction> _code;	// compiled geometry of all cells
+		std::vector<GeometryLattice> _lattices;
+		TransformationTable _transformations;
+		std::map<int, GeometryUniverse> _universes;
+		QString _hash;
+};
+
+#endif
@@ -0,0 +1,205 @@
+//#########################################################################################################
+//## GeometryChecker.cpp
+//#########################################################################################################
+//##
+//## Finds the errors of a Geometry that make MCNPX lose particles: points that are in more than one cell of a
+//## universe (overlaps) or in no cell of it (holes). The points are the centers of a regular grid over a box and
+//## a random point in every cell of the grid. Every point is followed down through the filled cells and lattice
+//## elements and checked at every universe it reaches. The slabs of the grid (one z index each) are divided over
+//## threads. The errors are grouped by universe and cells, with the first points where they were found.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "GeometryChecker.h"
+
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+
+#include <algorithm>
+
+#define MAX_UNIVERSE_DEPTH 32	// depth of nested universes after which a universe is assumed to fill itself
+#define MAX_SAMPLES 67108864	// grid points of the largest check
+#define MAX_POINTS 100			// points that are kept of every error
+#define CENTER_OFFSET 1.234e-4	// the centers are moved a bit (in voxels), so they are not on the planes of round coordinates
+
+// ==> GeometryCheckerTask
+// Checks slabs of the grid until all slabs are taken
+//--------------------------------------------------------------------
+class GeometryCheckerTask : public QRunnable
+{
+	public:
+		GeometryCheckerTask(GeometryChecker* checker) : _checker(checker) {}
+		void run() { _checker->checkSlabs(); }
+
+	private:
+		GeometryChecker* _checker;
+};
+
+// ==> nextRandom(state)
+// Next number of a linear congruential generator in [0, 1), every slab has its own state so a check is repeatable
+//--------------------------------------------------------------------
+static double nextRandom(unsigned int& state)
+{
+	state = state*1664525u + 1013904223u;
+	return (state >> 8)/16777216.0;
+}
+
+// ==> moreSamples(a, b)
+// Order of the errors: the ones with the most points first
+//--------------------------------------------------------------------
+static bool moreSamples(const GeometryError& a, const GeometryError& b)
+{
+	return a._samples > b._samples;
+}
+
+// ==> GeometryChecker(geometry)
+// Constructor
+//--------------------------------------------------------------------
+GeometryChecker::GeometryChecker(const Geometry* geometry)
+{
+	_geometry = geometry;
+	_sampleCount = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		_size[i] = 0;
+		_voxelSize[i] = 1.0;
+	}
+}
+
+// ==> ~GeometryChecker()
+// Destructor
+//--------------------------------------------------------------------
+GeometryChecker::~GeometryChecker()
+{
+}
+
+// ==> check(bounds, size, threads)
+// Check the center and a random point of every cell of the grid of size voxels over the bounds
+// Returns false if the bounds are not finite or the grid has more than MAX_SAMPLES points
+//--------------------------------------------------------------------
+bool GeometryChecker::check(const Box& bounds, const int size[3], int threads)
+{
+	_errors.clear();
+	_sampleCount = 0;
+	double voxels = (double)size[0]*size[1]*size[2];
+	if (!bounds.isFinite() || bounds.isEmpty() || size[0] < 1 || size[1] < 1 || size[2] < 1 || voxels > MAX_SAMPLES)
+	{
+		std::cout << "ERROR (GeometryChecker::check) => can't check a grid of " << size[0] << " x " << size[1] << " x " << size[2] << " points" << std::endl;
+		return false;
+	}
+
+	_bounds = bounds;
+	for (int i = 0; i < 3; i++)
+	{
+		_size[i] = size[i];
+		_voxelSize[i] = (bounds._max[i] - bounds._min[i])/size[i];
+	}
+	_slabErrors.assign(size[2], ErrorMap());
+	_nextSlab = 0;
+	if (threads <= 0)
+		threads = QThread::idealThreadCount();
+	if (threads < 1)
+		threads = 1;
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+	for (int i = 0; i < threads; i++)
+		pool.start(new GeometryCheckerTask(this));
+	pool.waitForDone();
+
+	// merge the errors of the slabs (in the order of the slabs, so the first points are the same for every run)
+	ErrorMap errors;
+	for (unsigned int slab = 0; slab < _slabErrors.size(); slab++)
+	{
+		ErrorMap::const_iterator iter;
+		for (iter = _slabErrors[slab].begin(); iter != _slabErrors[slab].end(); ++iter)
+		{
+			GeometryError& error = errors[iter->first];
+			if (error._samples == 0)
+			{
+				error._universe = iter->second._universe;
+				error._cells = iter->second._cells;
+			}
+			error._samples += iter->second._samples;
+			for (unsigned int i = 0; i < iter->second._points.size() && error._points.size() < 3*MAX_POINTS; i++)
+				error._points.push_back(iter->second._points[i]);
+		}
+	}
+	_slabErrors.clear();
+
+	for (ErrorMap::const_iterator iter = errors.begin(); iter != errors.end(); ++iter)
+		_errors.push_back(iter->second);
+	std::stable_sort(_errors.begin(), _errors.end(), moreSamples);
+	_sampleCount = 2*size[0]*size[1]*size[2];
+	return true;
+}
+
+// ==> checkSlabs()
+// Check the slabs (z index) that are not taken yet by another thread
+//--------------------------------------------------------------------
+void GeometryChecker::checkSlabs()
+{
+	std::vector<int> cells;
+	int k;
+	while ((k = _nextSlab.fetchAndAddRelaxed(1)) < _size[2])
+	{
+		ErrorMap& errors = _slabErrors[k];
+		unsigned int state = 2654435761u*(k + 1);
+		for (int j = 0; j < _size[1]; j++)
+			for (int i = 0; i < _size[0]; i++)
+			{
+				int index[3] = { i, j, k };
+				double center[3], p[3];
+				for (int a = 0; a < 3; a++)
+				{
+					center[a] = _bounds._min[a] + (index[a] + 0.5 + CENTER_OFFSET)*_voxelSize[a];
+					p[a] = _bounds._min[a] + (index[a] + nextRandom(state))*_voxelSize[a];
+				}
+				checkPoint(center, cells, errors);
+				checkPoint(p, cells, errors);
+			}
+	}
+}
+
+// ==> checkPoint(p, cells, errors)
+// Follow the point down through the universes: in every universe exactly one cell must contain it, else the
+// cells (none for a hole) are added to the errors and the point can't be followed further
+//		cells: buffer for the cells that contain the point
+//--------------------------------------------------------------------
+void GeometryChecker::checkPoint(const double p[3], std::vector<int>& cells, ErrorMap& errors) const
+{
+	double q[3] = { p[0], p[1], p[2] };
+	int universe = 0;
+	for (int depth = 0; depth < MAX_UNIVERSE_DEPTH; depth++)
+	{
+		cells.clear();
+		_geometry->findAllCells(universe, q, cells);
+		if (cells.size() != 1)
+		{
+			std::vector<int> numbers;
+			for (unsigned int i = 0; i < cells.size(); i++)
+				numbers.push_back(_geometry->getCell(cells[i])._number);
+			std::sort(numbers.begin(), numbers.end());
+
+			GeometryError& error = errors[std::make_pair(universe, numbers)];
+			if (error._samples == 0)
+			{
+				error._universe = universe;
+				error._cells = numbers;
+			}
+			error._samples++;
+			if (error._points.size() < 3*MAX_POINTS)
+				error._points.insert(error._points.end(), p, p + 3);
+			return;
+		}
+
+		Transformation transformation;
+		universe = _geometry->getFilling(cells[0], q, transformation);
+		if (universe == -1)
+			return;
+		transformation.apply(q, q);
+	}
+}
@@ -0,0 +1,71 @@
+//#########################################################################################################
+//## GeometryChecker.h
+//#########################################################################################################
+//##
+//## Finds the errors of a Geometry that make MCNPX lose particles: points that are in more than one cell of a
+//## universe (overlaps) or in no cell of it (holes). The points are the centers of a regular grid over a box and
+//## a random point in every cell of the grid. Every point is followed down through the filled cells and lattice
+//## elements and checked at every universe it reaches. The slabs of the grid (one z index each) are divided over
+//## threads. The errors are grouped by universe and cells, with the first points where they were found.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef GEOMETRY_CHECKER_H
+#define GEOMETRY_CHECKER_H
+
+#include <QAtomicInt>
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+#include "Geometry.h"
+
+// The points where the same cells of a universe overlap, or where the universe has no cell
+struct GeometryError
+{
+	GeometryError() : _universe(0), _samples(0) {}
+	bool isHole() const { return _cells.empty(); }
+
+	int _universe;
+	std::vector<int> _cells;		// numbers of the cells that claim the points (empty for a hole)
+	int _samples;					// number of points with this error
+	std::vector<double> _points;	// x y z of the first points (real world coordinates)
+};
+
+class GeometryChecker
+{
+	public:
+		GeometryChecker(const Geometry* geometry);
+		~GeometryChecker();
+
+		// Check the points of a grid of size voxels over the bounds with the threads (0 = number of cores)
+		// Returns false if the bounds are not finite or the grid is too large
+		bool check(const Box& bounds, const int size[3], int threads = 0);
+		// The errors that are found, the ones with the most points first
+		const std::vector<GeometryError>& getErrors() const { return _errors; }
+		int getSampleCount() const { return _sampleCount; }
+
+		// Check the slabs that are not taken yet (called by every thread)
+		void checkSlabs();
+
+	private:
+		typedef std::map<std::pair<int, std::vector<int> >, GeometryError> ErrorMap;
+
+		void checkPoint(const double p[3], std::vector<int>& cells, ErrorMap& errors) const;
+
+		const Geometry* _geometry;
+		std::vector<GeometryError> _errors;
+		int _sampleCount;
+
+		// check
+		Box _bounds;
+		int _size[3];
+		double _voxelSize[3];
+		std::vector<ErrorMap> _slabErrors;		// errors of every slab (a slab is checked by one thread)
+		QAtomicInt _nextSlab;
+};
+
+#endif
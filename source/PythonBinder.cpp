@@ -1,173 +1,483 @@
-//#########################################################################################################
-//## PythonBinder.cpp
-//#########################################################################################################
-//##
-//## Handles the callback of a python method
-//## It starts a python subprocess and emits a signal when the process is finished
-//##
-//## Part of MCNPX Visualiser
-//## (c) Nick Michiels for SCK-CEN Mol (2011)
-//#########################################################################################################
-
-#include "PythonBinder.h"
-
-#include <QStringList>
-#include <QList>
-#include <iostream>
-#include "Config.h"
-
-// ==> PythonBinder()
-// Constructor
-//--------------------------------------------------------------------
-PythonBinder::PythonBinder()
-{
-	_process = new QProcess(this);
-	_process->setWorkingDirectory (QString::fromStdString(Config::getSingleton().PYTHON) );
-
-	connect(_process, SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(finished( int, QProcess::ExitStatus)));
-	connect(_process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(error(QProcess::ProcessError)));
-	connect(_process, SIGNAL(started()), this, SLOT(started()));
-	connect(_process, SIGNAL(stateChanged(QProcess::ProcessState newState)), this, SLOT(stateChanged(QProcess::ProcessState newState)));
-	connect(_process, SIGNAL(readyReadStandardOutput()),this, SLOT(displayOutputMsg()));
-	connect(_process, SIGNAL(readyReadStandardError()),this, SLOT(displayErrorMsg()));
-}
-
-// ==> ~PythonBinder()
-// Destructor
-//--------------------------------------------------------------------
-PythonBinder::~PythonBinder()
-{
-	disconnect(_process, SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(finished( int, QProcess::ExitStatus)));
-	disconnect(_process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(error(QProcess::ProcessError)));
-	disconnect(_process, SIGNAL(started()), this, SLOT(started()));
-	disconnect(_process, SIGNAL(stateChanged(QProcess::ProcessState newState)), this, SLOT(stateChanged(QProcess::ProcessState newState)));
-	disconnect(_process, SIGNAL(readyReadStandardOutput()),this, SLOT(displayOutputMsg()));
-	disconnect(_process, SIGNAL(readyReadStandardError()),this, SLOT(displayErrorMsg()));
-
-	if (_process != NULL)
-		delete _process;
-}
-
-// ==> displayOutputMsg()
-// Called when there is standard output of the subprocess
-//--------------------------------------------------------------------
-void PythonBinder::displayOutputMsg(){
-	_process->setReadChannel(QProcess::StandardOutput);
-	QByteArray msg = _process->readAllStandardOutput();
-	emit pythonCallOutput(QString(msg.data()), _method, false);
-}
-
-// ==> displayErrorMsg()
-// Called when there is standard output error of the subprocess
-//--------------------------------------------------------------------
-void PythonBinder::displayErrorMsg(){
-  QByteArray msg = _process->readAllStandardError();
-  emit pythonCallOutput(QString(msg.data()), _method, true);
-}
-
-// ==> call(method, args)
-// Start the python subprocess
-//		method: python method to be called
-//		args: python arguments for the method
-//--------------------------------------------------------------------
-void PythonBinder::call(QString method, QStringList args)
-{	
-	_method = method;
-	QString PYTHON_PATH = "python";
-	QStringList pythonArgs;
-	// Use the right directory of the python functions
-	QString pythonFile = QString::fromStdString(Config::getSingleton().PYTHON);
-	pythonFile = pythonFile + method + ".py";
-	pythonArgs.push_back(pythonFile);
-	for (int i=0; i<args.size(); i++)
-	{
-		pythonArgs.push_back(args[i]);
-	}
-	
-	_process->setReadChannel(QProcess::StandardOutput);
-	_process->start(PYTHON_PATH, pythonArgs);
-}
-
-
-// ==> finished(exitCode, exitStatus)
-// Called when the subprocess is finished
-//--------------------------------------------------------------------
-void PythonBinder::finished( int exitCode, QProcess::ExitStatus exitStatus)
-{
-	std::cout << "QProcess Finished" << std::endl;
-	std::cout << "\tExit Code: " << exitCode << std::endl;
-	if (exitStatus == QProcess::NormalExit)
-	{
-		emit pythonCallFinished(_method);
-		std::cout << "\tExit Status: NormalExit" << std::endl;
-	}
-	else
-		std::cout << "\tExit Status: CrashExit " << std::endl;
-}
-
-// ==> error(error)
-// Called when there is an error in the subprocess
-//--------------------------------------------------------------------
-void PythonBinder::error(QProcess::ProcessError error)
-{
-	std::cout << "QProcess Error!" << std::endl;
-	std::cout << "\tError State: ";
-	switch (error)
-	{
-		case QProcess::Crashed:
-			std::cout << "Crashed";
-			break;
-		case QProcess::FailedToStart:
-			std::cout << "FailedToStart";
-			break;
-		case QProcess::ReadError:
-			std::cout << "ReadError";
-			break;
-		case QProcess::Timedout:
-			std::cout << "Timedout";
-			break;
-		case QProcess::UnknownError:
-			std::cout << "UnknownError";
-			break;
-		case QProcess::WriteError:
-			std::cout << "WriteError";
-			break;
-		default:
-			std::cout << "Unknown";
-	}
-	std::cout << std::endl;
-}
-
-
-// ==> started()
-// Called when the subprocess is started
-//--------------------------------------------------------------------
-void PythonBinder::started()
-{
-	std::cout << "QProcess Started" << std::endl;
-}
-
-
-// ==> stateChanged(newState)
-// Called when the state of the subprocess is changed
-//--------------------------------------------------------------------
-void PythonBinder::stateChanged(QProcess::ProcessState newState)
-{
-	std::cout << "QProcess State Changed!" << std::endl;
-	std::cout << "\tState: ";
-	switch (newState)
-	{
-	case QProcess::NotRunning:
-			std::cout << "NotRunning";
-			break;
-	case QProcess::Running:
-			std::cout << "Running";
-			break;
-	case QProcess::Starting:
-			std::cout << "Starting";
-			break;
-		default:
-			std::cout << "Unknown";
-	}
-	std::cout << std::endl;
+//#########################################################################################################
+//## PythonBinder.cpp
+//#########################################################################################################
+//##
+//## Handles the callback of a python method
+//## It starts a python subprocess and emits a signal when the process is finished
+//## Lines of the standard output that start with '@' are records (i.e. "@CELL&..." of the MCNPXPreParser),
+//## they are emitted in batches while the process is running instead of being printed
+//## Only one subprocess runs at a time, the other calls are queued (a new call of a method supersedes a stale call
+//## of the same method) and a call can be cancelled or times out after the time of its method (data/timeouts.txt)
+//## A low priority call waits for the other calls, a running one makes way for a new call and is queued again
+//## A call that can't start, crashes or exits with an error code fails instead of finishing (see pythonCallFailed)
+//## The subprocess runs in its own process group, a stopped call kills the whole group (the worker processes of the
+//## parser as well): first politely, after a grace period by force (on Windows the process tree is killed at once)
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "PythonBinder.h"
+
+#include <QStringList>
+#include <QList>
+#include <QFile>
+#include <QTextStream>
+#include <QRegExp>
+#include <iostream>
+#include "Config.h"
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <signal.h>
+	#include <unistd.h>
+#endif
+
+#define KILL_GRACE_PERIOD 2000 // milliseconds between the polite and the forced kill of a stopped call
+
+// ==> setupChildProcess()
+// Called in the child process before python is started: make it the leader of a new process group
+//--------------------------------------------------------------------
+void PythonProcess::setupChildProcess()
+{
+#ifndef _WIN32
+	setpgid(0, 0);
+#endif
+}
+
+// ==> PythonBinder()
+// Constructor
+//--------------------------------------------------------------------
+PythonBinder::PythonBinder()
+{
+	_process = new PythonProcess(this);
+	_processGroup = 0;
+	_exitCode = 0;
+	_call.lowPriority = false;
+	_process->setWorkingDirectory (QString::fromStdString(Config::getSingleton().PYTHON) );
+
+	connect(_process, SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(finished( int, QProcess::ExitStatus)));
+	connect(_process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(error(QProcess::ProcessError)));
+	connect(_process, SIGNAL(started()), this, SLOT(started()));
+	connect(_process, SIGNAL(stateChanged(QProcess::ProcessState newState)), this, SLOT(stateChanged(QProcess::ProcessState newState)));
+	connect(_process, SIGNAL(readyReadStandardOutput()),this, SLOT(displayOutputMsg()));
+	connect(_process, SIGNAL(readyReadStandardError()),this, SLOT(displayErrorMsg()));
+
+	_stopReason = NotStopped;
+	_timer.setSingleShot(true);
+	connect(&_timer, SIGNAL(timeout()), this, SLOT(timeout()));
+	_killTimer.setSingleShot(true);
+	connect(&_killTimer, SIGNAL(timeout()), this, SLOT(killTimeout()));
+	loadTimeouts();
+}
+
+// ==> ~PythonBinder()
+// Destructor
+//--------------------------------------------------------------------
+PythonBinder::~PythonBinder()
+{
+	disconnect(_process, SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(finished( int, QProcess::ExitStatus)));
+	disconnect(_process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(error(QProcess::ProcessError)));
+	disconnect(_process, SIGNAL(started()), this, SLOT(started()));
+	disconnect(_process, SIGNAL(stateChanged(QProcess::ProcessState newState)), this, SLOT(stateChanged(QProcess::ProcessState newState)));
+	disconnect(_process, SIGNAL(readyReadStandardOutput()),this, SLOT(displayOutputMsg()));
+	disconnect(_process, SIGNAL(readyReadStandardError()),this, SLOT(displayErrorMsg()));
+	disconnect(&_timer, SIGNAL(timeout()), this, SLOT(timeout()));
+	disconnect(&_killTimer, SIGNAL(timeout()), this, SLOT(killTimeout()));
+
+	// a running subprocess (and its workers) doesn't survive the application
+	if (_process != NULL && _process->state() != QProcess::NotRunning)
+	{
+		killProcessGroup(true);
+		_process->waitForFinished();
+	}
+
+	if (_process != NULL)
+		delete _process;
+}
+
+// ==> loadTimeouts()
+// Load the timeout of every python method out of the DATA/timeouts.txt file
+// The structure needs to be of the form: "method => seconds" (0 or a missing method = no timeout)
+//--------------------------------------------------------------------
+void PythonBinder::loadTimeouts()
+{
+	QString line;
+	QFile fileTimeouts(QString::fromStdString(Config::getSingleton().DATA) + "timeouts.txt");
+	if (!fileTimeouts.open(QFile::ReadOnly | QFile::Text))
+	{
+		std::cout << "ERROR (loadTimeouts) => couldn't open timeouts file" << std::endl;
+		return ;
+	}
+	QTextStream inTimeouts(&fileTimeouts);
+
+	QRegExp re("^[\\s\\t]*(\\S+)[\\s\\t]*=>[\\s\\t]*(\\d+)[\\s\\t]*[\\$]*[\\w\\W]*$", Qt::CaseInsensitive);
+	while (!((line = inTimeouts.readLine()).isNull()))
+	{
+		if (re.exactMatch(line))
+			_timeouts[re.cap(1)] = re.cap(2).toInt();
+	}
+	fileTimeouts.close();
+}
+
+// ==> displayOutputMsg()
+// Called when there is standard output of the subprocess
+// Only the complete lines are emitted, the rest waits for the next output (or the end of the subprocess)
+//--------------------------------------------------------------------
+void PythonBinder::displayOutputMsg(){
+	_process->setReadChannel(QProcess::StandardOutput);
+	QByteArray msg = _process->readAllStandardOutput();
+	if (_stopReason != NotStopped)
+		return; // the output of a stopped call isn't used anymore
+	_outputBuffer += QString(msg.data());
+
+	int end = _outputBuffer.lastIndexOf('\n');
+	if (end == -1)
+		return;
+	QString output = _outputBuffer.left(end + 1);
+	_outputBuffer = _outputBuffer.mid(end + 1);
+	emitOutput(output);
+}
+
+// ==> emitOutput(output)
+// Split the standard output in records and text to be printed
+//		output: complete lines of standard output
+//--------------------------------------------------------------------
+void PythonBinder::emitOutput(QString output)
+{
+	QStringList records;
+	QString text;
+	QStringList lines = output.split('\n');
+	for (int i=0; i<lines.size(); i++)
+	{
+		QString line = lines[i];
+		if (line.endsWith('\r'))
+			line.chop(1);
+		if (line.startsWith('@'))
+			records.push_back(line.mid(1));
+		else if (i < lines.size() - 1)
+			text += lines[i] + "\n";
+		else
+			text += lines[i];
+	}
+
+	if (records.size() > 0)
+		emit pythonCallRecords(records, _call.method);
+	if (!text.isEmpty())
+		emit pythonCallOutput(text, _call.method, false);
+}
+
+// ==> displayErrorMsg()
+// Called when there is standard output error of the subprocess
+//--------------------------------------------------------------------
+void PythonBinder::displayErrorMsg(){
+  QByteArray msg = _process->readAllStandardError();
+  if (_stopReason != NotStopped)
+    return;
+  emit pythonCallOutput(QString(msg.data()), _call.method, true);
+}
+
+// ==> call(method, args, lowPriority)
+// Start the python subprocess or queue the call when an other call is running
+// A queued or running call of the same method is stale, so it is removed out of the queue or cancelled (a low
+// priority call only replaces low priority calls)
+// A low priority call is queued after the other calls, a running low priority call is stopped for an other call and
+// queued again (it starts from scratch when the other calls are finished)
+//		method: python method to be called
+//		args: python arguments for the method
+//		lowPriority: the call waits for the other calls and makes way for them
+//--------------------------------------------------------------------
+void PythonBinder::call(QString method, QStringList args, bool lowPriority)
+{	
+	for (int i=_queue.size()-1; i>=0; i--)
+	{
+		if (_queue[i].method == method && (_queue[i].lowPriority || !lowPriority))
+			_queue.removeAt(i);
+	}
+
+	PythonCall pythonCall;
+	pythonCall.method = method;
+	pythonCall.args = args;
+	pythonCall.lowPriority = lowPriority;
+	int position = _queue.size();
+	if (!lowPriority)
+	{
+		for (int i=_queue.size()-1; i>=0; i--)
+		{
+			if (_queue[i].lowPriority)
+				position = i;
+		}
+	}
+	_queue.insert(position, pythonCall);
+
+	if (!isRunning())
+		startNext();
+	else if (_stopReason != NotStopped)
+		return; // the next call is started when the stopped call is finished
+	else if (_call.method == method && (_call.lowPriority || !lowPriority))
+		stop(Superseded); // the next call is started when the stale call is finished
+	else if (_call.lowPriority && !lowPriority)
+	{
+		_queue.push_back(_call);
+		stop(Superseded);
+	}
+}
+
+// ==> cancel()
+// Cancel the running call (pythonCallCancelled is emitted) and remove all the queued calls
+//--------------------------------------------------------------------
+void PythonBinder::cancel()
+{
+	_queue.clear();
+	if (isRunning() && _stopReason == NotStopped)
+		stop(Cancelled);
+}
+
+// ==> clear()
+// Stop the running call and remove the queued calls, nothing is emitted for them (i.e. the calls of the previous
+// file when a new file is preparsed)
+//--------------------------------------------------------------------
+void PythonBinder::clear()
+{
+	_queue.clear();
+	if (isRunning() && _stopReason == NotStopped)
+		stop(Superseded);
+}
+
+// ==> isRunning()
+// Returns if there is a running python subprocess
+//--------------------------------------------------------------------
+bool PythonBinder::isRunning()
+{
+	return _process->state() != QProcess::NotRunning;
+}
+
+// ==> start(pythonCall)
+// Start the python subprocess of a call
+//--------------------------------------------------------------------
+void PythonBinder::start(PythonCall pythonCall)
+{
+	_call = pythonCall;
+	_outputBuffer = "";
+	_stopReason = NotStopped;
+	_processGroup = 0;
+	QString PYTHON_PATH = "python";
+	QStringList pythonArgs;
+	// Use the right directory of the python functions
+	QString pythonFile = QString::fromStdString(Config::getSingleton().PYTHON);
+	pythonFile = pythonFile + pythonCall.method + ".py";
+	pythonArgs.push_back(pythonFile);
+	for (int i=0; i<pythonCall.args.size(); i++)
+	{
+		pythonArgs.push_back(pythonCall.args[i]);
+	}
+	
+	_process->setReadChannel(QProcess::StandardOutput);
+	_process->start(PYTHON_PATH, pythonArgs);
+
+	if (_timeouts.find(_call.method) != _timeouts.end() && _timeouts[_call.method] > 0)
+		_timer.start(_timeouts[_call.method] * 1000);
+}
+
+// ==> startNext()
+// Start the first queued call (unless a slot of a signal has already started a call)
+//--------------------------------------------------------------------
+void PythonBinder::startNext()
+{
+	if (_queue.isEmpty() || isRunning())
+		return;
+	PythonCall pythonCall = _queue.front();
+	_queue.pop_front();
+	start(pythonCall);
+}
+
+// ==> stop(reason)
+// Stop the running subprocess and its process group, finished is called when it has stopped
+// The group is asked to terminate, whatever still runs after the grace period is killed (see killTimeout)
+// Only the subprocess and its children are killed, a call never takes down the application
+//--------------------------------------------------------------------
+void PythonBinder::stop(StopReason reason)
+{
+	_stopReason = reason;
+	_timer.stop();
+	killProcessGroup(false);
+	_killTimer.start(KILL_GRACE_PERIOD);
+}
+
+// ==> killProcessGroup(force)
+// Send the process group of the running call a terminate (or with force a kill) signal
+// On Windows the process tree is always killed by force (a console process ignores the polite request)
+// Without a known group (python hasn't started yet) only the subprocess itself is stopped
+//--------------------------------------------------------------------
+void PythonBinder::killProcessGroup(bool force)
+{
+	if (_processGroup == 0)
+	{
+		if (force)
+			_process->kill();
+		else
+			_process->terminate();
+		return;
+	}
+#ifdef _WIN32
+	QProcess::execute("taskkill", QStringList() << "/T" << "/F" << "/PID" << QString::number(_processGroup));
+#else
+	::kill(-(pid_t)_processGroup, force ? SIGKILL : SIGTERM);
+#endif
+}
+
+// ==> killTimeout()
+// Called when a stopped call is still running after the grace period
+//--------------------------------------------------------------------
+void PythonBinder::killTimeout()
+{
+	if (isRunning())
+		killProcessGroup(true);
+}
+
+// ==> timeout()
+// Called when the running call takes longer than the timeout of its method
+//--------------------------------------------------------------------
+void PythonBinder::timeout()
+{
+	std::cout << "QProcess Timed Out" << std::endl;
+	if (isRunning() && _stopReason == NotStopped)
+		stop(TimedOut);
+}
+
+
+// ==> finished(exitCode, exitStatus)
+// Called when the subprocess is finished
+//--------------------------------------------------------------------
+void PythonBinder::finished( int exitCode, QProcess::ExitStatus exitStatus)
+{
+	std::cout << "QProcess Finished" << std::endl;
+	std::cout << "\tExit Code: " << exitCode << std::endl;
+
+	_exitCode = (exitStatus == QProcess::NormalExit) ? exitCode : -1;
+	_timer.stop();
+	_killTimer.stop();
+#ifndef _WIN32
+	// the workers of a stopped call may outlive python itself (the tree is already killed on Windows)
+	if (_stopReason != NotStopped && _processGroup != 0)
+		killProcessGroup(true);
+#endif
+	_processGroup = 0;
+
+	// the last output (and records) must be handled before the process is finished
+	displayOutputMsg();
+	if (!_outputBuffer.isEmpty() && _stopReason == NotStopped)
+	{
+		emitOutput(_outputBuffer);
+		_outputBuffer = "";
+	}
+
+	if (_stopReason == Superseded)
+	{
+		std::cout << "\tExit Status: Superseded" << std::endl;
+		_stopReason = NotStopped;
+	}
+	else if (_stopReason != NotStopped)
+	{
+		std::cout << "\tExit Status: " << (_stopReason == TimedOut ? "TimedOut" : "Cancelled") << std::endl;
+		bool timedOut = (_stopReason == TimedOut);
+		_stopReason = NotStopped;
+		emit pythonCallCancelled(_call.method, timedOut);
+	}
+	else if (exitStatus == QProcess::NormalExit && exitCode == 0)
+	{
+		emit pythonCallFinished(_call.method);
+		std::cout << "\tExit Status: NormalExit" << std::endl;
+	}
+	else
+	{
+		// a crashed call or an error exit may have left its files half written
+		std::cout << "\tExit Status: " << (exitStatus == QProcess::NormalExit ? "ErrorExit" : "CrashExit") << std::endl;
+		emit pythonCallFailed(_call.method);
+	}
+
+	startNext();
+}
+
+// ==> error(error)
+// Called when there is an error in the subprocess
+//--------------------------------------------------------------------
+void PythonBinder::error(QProcess::ProcessError error)
+{
+	std::cout << "QProcess Error!" << std::endl;
+	std::cout << "\tError State: ";
+	switch (error)
+	{
+		case QProcess::Crashed:
+			std::cout << "Crashed";
+			break;
+		case QProcess::FailedToStart:
+			std::cout << "FailedToStart";
+			_timer.stop();
+			_killTimer.stop();
+			_exitCode = -1;
+			// finished isn't called, so the caller is told here (a stopped call is reported as stopped)
+			if (_stopReason == NotStopped)
+				emit pythonCallFailed(_call.method);
+			else if (_stopReason != Superseded)
+				emit pythonCallCancelled(_call.method, _stopReason == TimedOut);
+			_stopReason = NotStopped;
+			startNext();
+			break;
+		case QProcess::ReadError:
+			std::cout << "ReadError";
+			break;
+		case QProcess::Timedout:
+			std::cout << "Timedout";
+			break;
+		case QProcess::UnknownError:
+			std::cout << "UnknownError";
+			break;
+		case QProcess::WriteError:
+			std::cout << "WriteError";
+			break;
+		default:
+			std::cout << "Unknown";
+	}
+	std::cout << std::endl;
+}
+
+
+// ==> started()
+// Called when the subprocess is started
+//--------------------------------------------------------------------
+void PythonBinder::started()
+{
+	std::cout << "QProcess Started" << std::endl;
+#ifdef _WIN32
+	_processGroup = _process->pid()->dwProcessId;
+#else
+	_processGroup = _process->pid(); // the subprocess leads its own group (see PythonProcess::setupChildProcess)
+#endif
+}
+
+
+// ==> stateChanged(newState)
+// Called when the state of the subprocess is changed
+//--------------------------------------------------------------------
+void PythonBinder::stateChanged(QProcess::ProcessState newState)
+{
+	std::cout << "QProcess State Changed!" << std::endl;
+	std::cout << "\tState: ";
+	switch (newState)
+	{
+	case QProcess::NotRunning:
+			std::cout << "NotRunning";
+			break;
+	case QProcess::Running:
+			std::cout << "Running";
+			break;
+	case QProcess::Starting:
+			std::cout << "Starting";
+			break;
+		default:
+			std::cout << "Unknown";
+	}
+	std::cout << std::endl;
 }
\ No newline at end of file
@@ -1,53 +1,115 @@
-//#########################################################################################################
-//## PythonBinder.h
-//#########################################################################################################
-//##
-//## Handles the callback of a python method
-//## It starts a python subprocess and emits a signal when the process is finished
-//##
-//## Part of MCNPX Visualiser
-//## (c) Nick Michiels for SCK-CEN Mol (2011)
-//#########################################################################################################
-
-
-#ifndef PYTHON_BINDER_H
-#define PYTHON_BINDER_H
-
-#include <QString>
-#include <QTimer>
-#include <QProcess>
-#include <iostream>
-#include <fstream>
-
-using namespace std;
-
-class PythonBinder : public QObject
-{
-	Q_OBJECT
-	public:
-		PythonBinder();
-		~PythonBinder();
-
-		void call(QString method, QStringList args); // calls a python method with a list of arguments
-
-	private:
-		QProcess* _process;
-		QString _method;
-
-	private slots:
-		void finished( int exitCode, QProcess::ExitStatus exitStatus);
-		void error(QProcess::ProcessError error);
-		void started();
-		void stateChanged(QProcess::ProcessState newState);
-		void displayOutputMsg();
-		void displayErrorMsg();
-
-	signals:
-		// emitted when the python call is finished
-		void pythonCallFinished(QString method);
-		// emitted when there is standard output from the python subprocess
-		void pythonCallOutput(QString output, QString method, bool isError = true);
-		
-};
-
+//#########################################################################################################
+//## PythonBinder.h
+//#########################################################################################################
+//##
+//## Handles the callback of a python method
+//## It starts a python subprocess and emits a signal when the process is finished
+//## Lines of the standard output that start with '@' are records (i.e. "@CELL&..." of the MCNPXPreParser),
+//## they are emitted in batches while the process is running instead of being printed
+//## Only one subprocess runs at a time, the other calls are queued (a new call of a method supersedes a stale call
+//## of the same method) and a call can be cancelled or times out after the time of its method (data/timeouts.txt)
+//## A low priority call waits for the other calls, a running one makes way for a new call and is queued again
+//## A call that can't start, crashes or exits with an error code fails instead of finishing (see pythonCallFailed)
+//## The subprocess runs in its own process group, a stopped call kills the whole group (the worker processes of the
+//## parser as well): first politely, after a grace period by force (on Windows the process tree is killed at once)
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+
+#ifndef PYTHON_BINDER_H
+#define PYTHON_BINDER_H
+
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <QProcess>
+#include <QList>
+#include <iostream>
+#include <fstream>
+#include <map>
+
+using namespace std;
+
+// a call of a python method that waits in the queue of the PythonBinder
+struct PythonCall
+{
+	QString method;
+	QStringList args;
+	bool lowPriority; // waits for the other calls and makes way for them (i.e. a parse in the background)
+};
+
+// the python subprocess, started as the leader of a new process group so its children can be killed with it
+class PythonProcess : public QProcess
+{
+	public:
+		PythonProcess(QObject* parent = 0) : QProcess(parent) {}
+
+	protected:
+		void setupChildProcess();
+};
+
+class PythonBinder : public QObject
+{
+	Q_OBJECT
+	public:
+		// reason why the running call is stopped
+		enum StopReason { NotStopped, Cancelled, Superseded, TimedOut };
+
+		PythonBinder();
+		~PythonBinder();
+
+		void call(QString method, QStringList args, bool lowPriority = false); // calls a python method with a list of arguments
+		void cancel(); // cancels the running call and all the queued calls
+		void clear(); // stops the running call and removes the queued calls without emitting anything (i.e. a new file)
+		bool isRunning();
+		bool isLowPriority() { return _call.lowPriority; } // the running call (or the call of the emitted signal) has a low priority
+		int getExitCode() { return _exitCode; } // exit code of the last finished call (-1 if it crashed or didn't start)
+
+	private:
+		PythonProcess* _process;
+		int _exitCode;
+		long _processGroup; // id of the process group (Windows: process) of the running call, 0 = not known
+		PythonCall _call; // the running call (the last call when none is running)
+		QString _outputBuffer; // standard output after the last complete line
+		QList<PythonCall> _queue; // calls that wait for the running call
+		StopReason _stopReason; // the output of a stopped call is ignored
+		QTimer _timer; // timeout of the running call
+		QTimer _killTimer; // grace period of a stopped call before it is killed by force
+		std::map<QString, int> _timeouts; // timeout in seconds per python method
+
+		void start(PythonCall pythonCall);
+		void startNext();
+		void stop(StopReason reason);
+		void killProcessGroup(bool force);
+		void loadTimeouts();
+		void emitOutput(QString output);
+
+	private slots:
+		void finished( int exitCode, QProcess::ExitStatus exitStatus);
+		void error(QProcess::ProcessError error);
+		void started();
+		void stateChanged(QProcess::ProcessState newState);
+		void displayOutputMsg();
+		void displayErrorMsg();
+		void timeout();
+		void killTimeout();
+
+	signals:
+		// emitted when the python call is finished
+		void pythonCallFinished(QString method);
+		// emitted when there is standard output from the python subprocess
+		void pythonCallOutput(QString output, QString method, bool isError = true);
+		// emitted when the python subprocess has written a batch of records (without the '@')
+		void pythonCallRecords(QStringList records, QString method);
+		// emitted when the python call is cancelled or has timed out (instead of pythonCallFinished, a superseded call
+		// emits nothing)
+		void pythonCallCancelled(QString method, bool timedOut);
+		// emitted when the python call couldn't start, crashed or exited with an error code (instead of
+		// pythonCallFinished, its output files can't be trusted)
+		void pythonCallFailed(QString method);
+		
+};
+
 #endif
\ No newline at end of file
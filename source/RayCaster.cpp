@@ -0,0 +1,537 @@
+//#########################################################################################################
+//## RayCaster.cpp
+//#########################################################################################################
+//##
+//## Native preview renderer of the Geometry, without POV-Ray
+//## Every ray is cut by the surfaces of the universe it walks through, the cell of every piece is found
+//## by its midpoint and the first visible cell gives the pixel its flat shaded material color.
+//## A filled cell continues the walk in its universe (a lattice element by element). The camera and the sections are the same as
+//## the ones that the CameraManager writes for POV-Ray. The rows of the image are divided over threads.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "RayCaster.h"
+
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+
+#include <cmath>
+#include <algorithm>
+
+#define PI 3.14159265
+
+#define INFINITE_T 1e30			// end of a ray that doesn't leave the geometry
+#define MAX_UNIVERSE_DEPTH 32	// depth of nested universes after which a universe is assumed to fill itself
+#define AMBIENT 0.2				// part of the color of a surface that doesn't face the camera
+#define MAX_LATTICE_ELEMENTS 100000	// number of lattice elements after which the walk through a lattice stops
+
+// ==> RayCasterTask
+// Renders rows of the image until all rows are taken
+//--------------------------------------------------------------------
+class RayCasterTask : public QRunnable
+{
+	public:
+		RayCasterTask(RayCaster* caster) : _caster(caster) {}
+		void run() { _caster->renderRows(); }
+
+	private:
+		RayCaster* _caster;
+};
+
+// ==> cross(a, b, result)
+//--------------------------------------------------------------------
+static void cross(const double a[3], const double b[3], double result[3])
+{
+	result[0] = a[1]*b[2] - a[2]*b[1];
+	result[1] = a[2]*b[0] - a[0]*b[2];
+	result[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+// ==> normalize(a)
+// Normalize a vector in place, returns its length
+//--------------------------------------------------------------------
+static double normalize(double a[3])
+{
+	double length = std::sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+	if (length > 0.0)
+	{
+		a[0] /= length;
+		a[1] /= length;
+		a[2] /= length;
+	}
+	return length;
+}
+
+// ==> RayCaster(geometry)
+// Constructor
+//--------------------------------------------------------------------
+RayCaster::RayCaster(const Geometry* geometry)
+{
+	_geometry = geometry;
+	_threads = 0;
+
+	Camera camera;
+	setCamera(&camera);
+
+	_sectionAnglesOr = false;
+	_visibleCells.assign(_geometry->getCellCount(), true);
+	_background = qRgb(107, 139, 170);
+
+	_bits = 0;
+	_bytesPerLine = 0;
+	_width = 0;
+	_height = 0;
+}
+
+// ==> ~RayCaster()
+// Destructor
+//--------------------------------------------------------------------
+RayCaster::~RayCaster()
+{
+}
+
+// ==> setCamera(camera)
+// Look from position + strafe to strafe, with the y axis up (the right vector of POV-Ray is <-4/3,0,0>,
+// so the image is not mirrored)
+//--------------------------------------------------------------------
+void RayCaster::setCamera(const Camera* camera)
+{
+	_position[0] = camera->_camPosX + camera->_camStrafeX;
+	_position[1] = camera->_camPosY + camera->_camStrafeY;
+	_position[2] = camera->_camPosZ + camera->_camStrafeZ;
+
+	_direction[0] = -camera->_camPosX;
+	_direction[1] = -camera->_camPosY;
+	_direction[2] = -camera->_camPosZ;
+	if (normalize(_direction) == 0.0)
+		_direction[2] = 1.0;
+
+	double sky[3] = { 0.0, 1.0, 0.0 };
+	cross(_direction, sky, _right);
+	if (normalize(_right) < 1e-6)
+	{
+		// looking along the y axis
+		double skyZ[3] = { 0.0, 0.0, 1.0 };
+		cross(_direction, skyZ, _right);
+		normalize(_right);
+	}
+	cross(_right, _direction, _up);
+}
+
+// ==> setSections(sections, enabled)
+// The region that the section keeps as quadrics that must be negative (see CameraManager::createPovRayFile)
+//		shortcut: the half space on the side of the base
+//		rectangular: the box between the planes (at position - 1)
+//		pie piece: the cylinder and the angle between the two planes (the union of the half spaces if the angle
+//		is larger than 180 degrees)
+//--------------------------------------------------------------------
+void RayCaster::setSections(const Sections3D* sections, bool enabled)
+{
+	_sectionParts.clear();
+	_sectionAngles.clear();
+	_sectionAnglesOr = false;
+
+	if (sections->_useShortCut)
+	{
+		double base = sections->_shortCutBase;
+		switch (sections->_typeShortCut)
+		{
+			case Sections3D::SHORTCUT_X:			_sectionParts.push_back(Quadric::plane(1, 0, 0, base)); break;
+			case Sections3D::SHORTCUT_X_INVERSE:	_sectionParts.push_back(Quadric::plane(-1, 0, 0, -base)); break;
+			case Sections3D::SHORTCUT_Y:			_sectionParts.push_back(Quadric::plane(0, 1, 0, base)); break;
+			case Sections3D::SHORTCUT_Y_INVERSE:	_sectionParts.push_back(Quadric::plane(0, -1, 0, -base)); break;
+			case Sections3D::SHORTCUT_Z:			_sectionParts.push_back(Quadric::plane(0, 0, 1, base)); break;
+			case Sections3D::SHORTCUT_Z_INVERSE:	_sectionParts.push_back(Quadric::plane(0, 0, -1, -base)); break;
+		}
+		return;
+	}
+
+	if (!enabled)
+		return;
+
+	if (sections->_typeSections == Sections3D::SECTIONS_RECTANGULAR)
+	{
+		_sectionParts.push_back(Quadric::plane(-1, 0, 0, -(sections->_xPlaneMinPos-1)));
+		_sectionParts.push_back(Quadric::plane(1, 0, 0, sections->_xPlaneMaxPos-1));
+		_sectionParts.push_back(Quadric::plane(0, -1, 0, -(sections->_yPlaneMinPos-1)));
+		_sectionParts.push_back(Quadric::plane(0, 1, 0, sections->_yPlaneMaxPos-1));
+		_sectionParts.push_back(Quadric::plane(0, 0, -1, -(sections->_zPlaneMinPos-1)));
+		_sectionParts.push_back(Quadric::plane(0, 0, 1, sections->_zPlaneMaxPos-1));
+		return;
+	}
+
+	// pie piece around the axis that is perpendicular to the plane of the section
+	int axis = 2;
+	if (sections->_typeSections == Sections3D::SECTIONS_YZ)
+		axis = 0;
+	else if (sections->_typeSections == Sections3D::SECTIONS_XZ)
+		axis = 1;
+	double a[3] = { 0.0, 0.0, 0.0 };
+	a[axis] = 1.0;
+	double s[3] = { sections->_strafeX, sections->_strafeY, sections->_strafeZ };
+
+	double m[3][3];
+	double l[3] = { 0.0, 0.0, 0.0 };
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			m[i][j] = (i == j ? 1.0 : 0.0) - a[i]*a[j];
+	Quadric cylinder = Quadric::fromMatrix(m, l, -sections->_radius*sections->_radius);
+	cylinder.translate(s);
+	_sectionParts.push_back(cylinder);
+	_sectionParts.push_back(Quadric::plane(a[0], a[1], a[2], s[axis] + sections->_height/2.0));
+	_sectionParts.push_back(Quadric::plane(-a[0], -a[1], -a[2], -s[axis] + sections->_height/2.0));
+
+	// normal of the rotated plane (y for XY, z for YZ and x for XZ) over the angle
+	double angles[2] = { sections->_angleMin*PI/180.0, sections->_angleMax*PI/180.0 };
+	double n[2][3];
+	for (int i = 0; i < 2; i++)
+	{
+		if (sections->_typeSections == Sections3D::SECTIONS_XY)
+		{
+			n[i][0] = -std::sin(angles[i]);
+			n[i][1] = std::cos(angles[i]);
+			n[i][2] = 0.0;
+		}
+		else if (sections->_typeSections == Sections3D::SECTIONS_YZ)
+		{
+			n[i][0] = 0.0;
+			n[i][1] = -std::sin(angles[i]);
+			n[i][2] = std::cos(angles[i]);
+		}
+		else
+		{
+			n[i][0] = std::cos(angles[i]);
+			n[i][1] = 0.0;
+			n[i][2] = -std::sin(angles[i]);
+		}
+	}
+	// keeps n_min.(p - s) >= 0 and n_max.(p - s) <= 0
+	double nsMin = n[0][0]*s[0] + n[0][1]*s[1] + n[0][2]*s[2];
+	double nsMax = n[1][0]*s[0] + n[1][1]*s[1] + n[1][2]*s[2];
+	_sectionAngles.push_back(Quadric::plane(-n[0][0], -n[0][1], -n[0][2], -nsMin));
+	_sectionAngles.push_back(Quadric::plane(n[1][0], n[1][1], n[1][2], nsMax));
+	_sectionAnglesOr = std::fabs(sections->_angleMax - sections->_angleMin) > 180;
+}
+
+// ==> setMaterials(materials)
+// Colors of the materials, a material with alpha 0 is not drawn (like the textures of the python parser)
+//--------------------------------------------------------------------
+void RayCaster::setMaterials(const std::map<int, Material*>& materials)
+{
+	_colors.clear();
+	std::map<int, Material*>::const_iterator iter;
+	for (iter = materials.begin(); iter != materials.end(); ++iter)
+		if (iter->second->getAlpha() > 0.0)
+			_colors[iter->first] = iter->second->getColor().rgb();
+}
+
+// ==> setVisibility(cells, universes)
+// Hidden cells and universes are not drawn
+//--------------------------------------------------------------------
+void RayCaster::setVisibility(const std::map<int, Cell*>& cells, const std::map<int, bool>& universes)
+{
+	_visibleCells.assign(_geometry->getCellCount(), true);
+	for (int i = 0; i < _geometry->getCellCount(); i++)
+	{
+		std::map<int, Cell*>::const_iterator iter = cells.find(_geometry->getCell(i)._number);
+		if (iter != cells.end())
+			_visibleCells[i] = iter->second->isVisible();
+	}
+	_universes = universes;
+}
+
+// ==> render(width, height)
+// Render the geometry with the camera (horizontal angle of 45 degrees) to an image
+//--------------------------------------------------------------------
+QImage RayCaster::render(int width, int height)
+{
+	QImage image(width, height, QImage::Format_RGB32);
+	image.fill(_background);
+	if (width <= 0 || height <= 0)
+		return image;
+
+	_bits = image.bits();
+	_bytesPerLine = image.bytesPerLine();
+	_width = width;
+	_height = height;
+	_nextRow = 0;
+
+	int threads = _threads > 0 ? _threads : QThread::idealThreadCount();
+	if (threads < 1)
+		threads = 1;
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+	for (int i = 0; i < threads; i++)
+		pool.start(new RayCasterTask(this));
+	pool.waitForDone();
+
+	_bits = 0;
+	return image;
+}
+
+// ==> renderRows()
+// Render the rows of the image that are not taken yet by another thread
+//--------------------------------------------------------------------
+void RayCaster::renderRows()
+{
+	double tangent = std::tan(22.5*PI/180.0);
+	double aspect = (double)_height/_width;
+	TraceBuffers buffers;
+	buffers._crossings.reserve(256);
+	buffers._candidates.reserve(256);
+
+	int row;
+	while ((row = _nextRow.fetchAndAddRelaxed(1)) < _height)
+	{
+		QRgb* line = (QRgb*)(_bits + row*_bytesPerLine);
+		double v = (1.0 - 2.0*(row + 0.5)/_height)*tangent*aspect;
+		for (int column = 0; column < _width; column++)
+		{
+			double u = (2.0*(column + 0.5)/_width - 1.0)*tangent;
+			double d[3];
+			for (int i = 0; i < 3; i++)
+				d[i] = _direction[i] + u*_right[i] + v*_up[i];
+			normalize(d);
+
+			double entryNormal[3] = { -d[0], -d[1], -d[2] };
+			Hit hit;
+			if (trace(0, _position, d, 0.0, INFINITE_T, entryNormal, buffers, hit, 0))
+				line[column] = shade(hit, d);
+		}
+	}
+}
+
+// ==> trace(universe, o, d, tMin, tMax, entryNormal, buffers, hit, depth)
+// Walk the ray o + t d from tMin to tMax through the cells of a universe
+// The ray is cut at every crossing with a surface of the cells that it can meet (see Geometry::findCells, and with
+// the section at the top level) and the cell of every piece is found by its midpoint. The first piece that is in a
+// visible cell is the hit, a filled cell continues the walk through its universe over the piece
+//		entryNormal: normal of the surface at tMin
+//		buffers: buffers for the crossings and candidates (every level adds its own at the end and removes them again)
+//--------------------------------------------------------------------
+bool RayCaster::trace(int universe, const double o[3], const double d[3], double tMin, double tMax, const double entryNormal[3],
+					TraceBuffers& buffers, Hit& hit, int depth)
+{
+	if (!_geometry->getUniverse(universe) || depth > MAX_UNIVERSE_DEPTH)
+		return false;
+
+	// the surfaces of the cells that the ray can meet
+	std::vector<int>& candidates = buffers._candidates;
+	unsigned int firstCandidate = candidates.size();
+	_geometry->findCells(universe, o, d, tMin, tMax, candidates);
+	unsigned int firstSurface = candidates.size();
+	for (unsigned int i = firstCandidate; i < firstSurface; i++)
+	{
+		const std::vector<int>& surfaces = _geometry->getCell(candidates[i])._surfaces;
+		candidates.insert(candidates.end(), surfaces.begin(), surfaces.end());
+	}
+	std::sort(candidates.begin() + firstSurface, candidates.end());
+	candidates.erase(std::unique(candidates.begin() + firstSurface, candidates.end()), candidates.end());
+
+	std::vector<Crossing>& crossings = buffers._crossings;
+	unsigned int first = crossings.size();
+	double roots[2];
+	Crossing crossing;
+	for (unsigned int i = firstSurface; i < candidates.size(); i++)
+	{
+		const Surface& surface = _geometry->getSurface(candidates[i]);
+		for (unsigned int j = 0; j < surface._parts.size(); j++)
+		{
+			int n = surface._parts[j].intersect(o, d, roots);
+			for (int k = 0; k < n; k++)
+			{
+				if (roots[k] > tMin && roots[k] < tMax)
+				{
+					crossing.t = roots[k];
+					crossing.surface = candidates[i];
+					crossing.part = j;
+					crossings.push_back(crossing);
+				}
+			}
+		}
+	}
+	candidates.resize(firstCandidate);
+	if (depth == 0)
+	{
+		unsigned int sections = _sectionParts.size() + _sectionAngles.size();
+		for (unsigned int j = 0; j < sections; j++)
+		{
+			const Quadric& quadric = (j < _sectionParts.size()) ? _sectionParts[j] : _sectionAngles[j - _sectionParts.size()];
+			int n = quadric.intersect(o, d, roots);
+			for (int k = 0; k < n; k++)
+			{
+				if (roots[k] > tMin && roots[k] < tMax)
+				{
+					crossing.t = roots[k];
+					crossing.surface = -1;
+					crossing.part = j;
+					crossings.push_back(crossing);
+				}
+			}
+		}
+	}
+	std::sort(crossings.begin() + first, crossings.end());
+
+	double start = tMin;
+	double normal[3] = { entryNormal[0], entryNormal[1], entryNormal[2] };
+	bool found = false;
+	unsigned int last = crossings.size();
+	for (unsigned int i = first; i <= last && !found; i++)
+	{
+		double end = (i < last) ? crossings[i].t : tMax;
+		if (end - start > 1e-9*(1.0 + std::fabs(start)))
+		{
+			double mid = (end >= INFINITE_T) ? start + std::max(1.0, std::fabs(start)) : 0.5*(start + end);
+			double p[3] = { o[0] + mid*d[0], o[1] + mid*d[1], o[2] + mid*d[2] };
+			if (depth > 0 || keepsSection(p))
+			{
+				int cell = _geometry->findCell(universe, p);
+				if (cell != -1 && isVisible(_geometry->getCell(cell)))
+				{
+					if (_geometry->isFilled(cell))
+						found = traceFilling(cell, o, d, start, end, normal, buffers, hit, depth);
+					else
+					{
+						hit.t = start;
+						hit.cell = cell;
+						for (int k = 0; k < 3; k++)
+							hit.normal[k] = normal[k];
+						found = true;
+					}
+				}
+			}
+		}
+		if (i < last)
+		{
+			getNormal(crossings[i], o, d, normal);
+			start = end;
+		}
+	}
+
+	crossings.resize(first);
+	return found;
+}
+
+// ==> traceFilling(cell, o, d, tMin, tMax, entryNormal, buffers, hit, depth)
+// Walk the piece tMin .. tMax of the ray through the universe that fills the cell. A lattice is walked element by
+// element (see Geometry::getElementExit), with the ray moved to the coordinates of the universe of every element (the
+// distances along the ray stay the same) and the normal of a hit in the universe turned back.
+// An element that is the lattice cell itself is a hit if the material of the lattice is drawn.
+//--------------------------------------------------------------------
+bool RayCaster::traceFilling(int cell, const double o[3], const double d[3], double tMin, double tMax, const double entryNormal[3],
+					TraceBuffers& buffers, Hit& hit, int depth)
+{
+	double start = tMin;
+	double normal[3] = { entryNormal[0], entryNormal[1], entryNormal[2] };
+	for (int element = 0; element < MAX_LATTICE_ELEMENTS && start < tMax; element++)
+	{
+		// the element is found just after the start of its piece
+		double probe = start + 1e-9*(1.0 + std::fabs(start));
+		double p[3] = { o[0] + probe*d[0], o[1] + probe*d[1], o[2] + probe*d[2] };
+		double exitNormal[3] = { normal[0], normal[1], normal[2] };
+		double end = std::min(tMax, probe + _geometry->getElementExit(cell, p, d, exitNormal));
+
+		Transformation transformation;
+		int universe = _geometry->getFilling(cell, p, transformation);
+		if (universe != -1)
+		{
+			std::map<int, bool>::const_iterator iter = _universes.find(universe);
+			if (iter == _universes.end() || iter->second)
+			{
+				double localOrigin[3];
+				double localDirection[3];
+				double localNormal[3];
+				transformation.apply(o, localOrigin);
+				transformation.rotate(d, localDirection);
+				transformation.rotate(normal, localNormal);
+				if (trace(universe, localOrigin, localDirection, start, end, localNormal, buffers, hit, depth + 1))
+				{
+					transformation.rotateInverse(hit.normal, hit.normal);
+					return true;
+				}
+			}
+		}
+		else if (_colors.find(_geometry->getCell(cell)._material) != _colors.end())
+		{
+			hit.t = start;
+			hit.cell = cell;
+			for (int k = 0; k < 3; k++)
+				hit.normal[k] = normal[k];
+			return true;
+		}
+
+		for (int k = 0; k < 3; k++)
+			normal[k] = exitNormal[k];
+		start = end;
+	}
+	return false;
+}
+
+// ==> getNormal(crossing, o, d, normal)
+// Normal of the crossed surface part (or section quadric) in the crossing
+//--------------------------------------------------------------------
+void RayCaster::getNormal(const Crossing& crossing, const double o[3], const double d[3], double normal[3])
+{
+	double p[3] = { o[0] + crossing.t*d[0], o[1] + crossing.t*d[1], o[2] + crossing.t*d[2] };
+	if (crossing.surface == -1)
+	{
+		if (crossing.part < (int)_sectionParts.size())
+			_sectionParts[crossing.part].gradient(p, normal);
+		else
+			_sectionAngles[crossing.part - _sectionParts.size()].gradient(p, normal);
+	}
+	else
+		_geometry->getSurface(crossing.surface)._parts[crossing.part].gradient(p, normal);
+}
+
+// ==> keepsSection(p)
+// Returns if the point is in the region that the section keeps
+//--------------------------------------------------------------------
+bool RayCaster::keepsSection(const double p[3]) const
+{
+	for (unsigned int i = 0; i < _sectionParts.size(); i++)
+		if (_sectionParts[i].evaluate(p) > 0.0)
+			return false;
+	if (_sectionAngles.empty())
+		return true;
+	bool inFirst = _sectionAngles[0].evaluate(p) <= 0.0;
+	bool inSecond = _sectionAngles[1].evaluate(p) <= 0.0;
+	return _sectionAnglesOr ? (inFirst || inSecond) : (inFirst && inSecond);
+}
+
+// ==> isVisible(cell)
+// Returns if the cell is drawn: not in the outside world (imp:n=0), not hidden and with a visible material
+// or a visible universe in it (the elements of a lattice are checked by traceFilling)
+//--------------------------------------------------------------------
+bool RayCaster::isVisible(const GeometryCell& cell) const
+{
+	if (cell._imp0 || !_visibleCells[&cell - &_geometry->getCell(0)])
+		return false;
+	if (cell._latticeIndex != -1)
+		return true;
+	if (cell._fill != 0)
+	{
+		std::map<int, bool>::const_iterator iter = _universes.find(cell._fill);
+		return iter == _universes.end() || iter->second;
+	}
+	return _colors.find(cell._material) != _colors.end();
+}
+
+// ==> shade(hit, d)
+// Flat shaded color of the material of the hit cell, lit from the camera
+//--------------------------------------------------------------------
+QRgb RayCaster::shade(const Hit& hit, const double d[3]) const
+{
+	double normal[3] = { hit.normal[0], hit.normal[1], hit.normal[2] };
+	double intensity = 1.0;
+	if (normalize(normal) > 0.0)
+		intensity = std::fabs(normal[0]*d[0] + normal[1]*d[1] + normal[2]*d[2]);
+	intensity = AMBIENT + (1.0 - AMBIENT)*intensity;
+
+	QRgb color = _colors.find(_geometry->getCell(hit.cell)._material)->second;
+	return qRgb((int)(qRed(color)*intensity), (int)(qGreen(color)*intensity), (int)(qBlue(color)*intensity));
+}
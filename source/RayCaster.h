@@ -0,0 +1,118 @@
+//#########################################################################################################
+//## RayCaster.h
+//#########################################################################################################
+//##
+//## Native preview renderer of the Geometry, without POV-Ray
+//## Every ray is cut by the surfaces of the universe it walks through, the cell of every piece is found
+//## by its midpoint and the first visible cell gives the pixel its flat shaded material color.
+//## A filled cell continues the walk in its universe (a lattice element by element). The camera and the sections are the same as
+//## the ones that the CameraManager writes for POV-Ray. The rows of the image are divided over threads.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef RAY_CASTER_H
+#define RAY_CASTER_H
+
+#include <QImage>
+#include <QColor>
+#include <QAtomicInt>
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+#include "Geometry.h"
+#include "Camera.h"
+#include "Sections3D.h"
+#include "Material.h"
+#include "Cell.h"
+
+class RayCaster
+{
+	public:
+		RayCaster(const Geometry* geometry);
+		~RayCaster();
+
+		// Camera of the POV-Ray scene: look_at strafe, location position + strafe, horizontal angle of 45 degrees
+		void setCamera(const Camera* camera);
+		// Keep only the region of the section (same planes as CameraManager::createPovRayFile)
+		void setSections(const Sections3D* sections, bool enabled);
+		// Colors of the materials, a material without color or with alpha 0 is not drawn
+		void setMaterials(const std::map<int, Material*>& materials);
+		// Hidden cells and universes are not drawn (see CameraManager::createSwitchesFile)
+		void setVisibility(const std::map<int, Cell*>& cells, const std::map<int, bool>& universes);
+		void setBackgroundColor(QColor color) { _background = color.rgb(); }
+		// Number of threads (0 = number of cores)
+		void setThreads(int threads) { _threads = threads; }
+
+		// Render the geometry to an image
+		QImage render(int width, int height);
+
+		// Render the rows of the image that are not taken yet (called by every thread)
+		void renderRows();
+
+	private:
+		// intersection of a ray with a surface part (or with a section quadric if surface is -1)
+		struct Crossing
+		{
+			double t;
+			int surface;
+			int part;
+			bool operator<(const Crossing& other) const { return t < other.t; }
+		};
+
+		struct Hit
+		{
+			double t;
+			int cell;
+			double normal[3];
+		};
+
+		// buffers of a thread (every level of trace adds its own items at the end and removes them again)
+		struct TraceBuffers
+		{
+			std::vector<Crossing> _crossings;
+			std::vector<int> _candidates;		// cells that the ray can meet, followed by their surfaces
+		};
+
+		bool trace(int universe, const double o[3], const double d[3], double tMin, double tMax, const double entryNormal[3],
+					TraceBuffers& buffers, Hit& hit, int depth);
+		bool traceFilling(int cell, const double o[3], const double d[3], double tMin, double tMax, const double entryNormal[3],
+					TraceBuffers& buffers, Hit& hit, int depth);
+		void getNormal(const Crossing& crossing, const double o[3], const double d[3], double normal[3]);
+		bool keepsSection(const double p[3]) const;
+		bool isVisible(const GeometryCell& cell) const;
+		QRgb shade(const Hit& hit, const double d[3]) const;
+
+		const Geometry* _geometry;
+		int _threads;
+
+		// camera
+		double _position[3];
+		double _direction[3];
+		double _right[3];
+		double _up[3];
+
+		// section: a point is kept if all _sectionParts are negative and one of the _sectionAngles ('or') or
+		// all of them are negative
+		std::vector<Quadric> _sectionParts;
+		std::vector<Quadric> _sectionAngles;
+		bool _sectionAnglesOr;
+
+		// materials and visibility
+		std::map<int, QRgb> _colors;
+		std::vector<bool> _visibleCells;		// per cell index
+		std::map<int, bool> _universes;
+		QRgb _background;
+
+		// image that is rendered
+		uchar* _bits;
+		int _bytesPerLine;
+		int _width;
+		int _height;
+		QAtomicInt _nextRow;
+};
+
+#endif
@@ -0,0 +1,325 @@
+//#########################################################################################################
+//## SlicePlotter.cpp
+//#########################################################################################################
+//##
+//## Native 2D plotter of the Geometry, like the plotter of MCNP
+//## Every pixel of an axis aligned plane is classified into the cell that contains it (descending into
+//## filled cells and lattice elements) and gets the color of its material. Pixels on the border of two cells are drawn as
+//## outlines. The rows of the image are divided over threads, the pixels of a row are classified together. With a
+//## VoxelGrid the pixels in the grid take the cell of their voxel (a lookup instead of a classification).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "SlicePlotter.h"
+
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+
+#include <cmath>
+#include <algorithm>
+
+#define MAX_UNIVERSE_DEPTH 32	// depth of nested universes after which a universe is assumed to fill itself
+
+// ==> SlicePlotterTask
+// Classifies rows of the image until all rows are taken
+//--------------------------------------------------------------------
+class SlicePlotterTask : public QRunnable
+{
+	public:
+		SlicePlotterTask(SlicePlotter* plotter) : _plotter(plotter) {}
+		void run() { _plotter->renderRows(); }
+
+	private:
+		SlicePlotter* _plotter;
+};
+
+// ==> SlicePlotter(geometry)
+// Constructor
+//--------------------------------------------------------------------
+SlicePlotter::SlicePlotter(const Geometry* geometry)
+{
+	_geometry = geometry;
+	_grid = 0;
+	_threads = 0;
+	_outlines = true;
+
+	double origin[3] = { 0.0, 0.0, 0.0 };
+	setPlane(2, origin, 100.0, 100.0);
+
+	_visibleCells.assign(_geometry->getCellCount(), true);
+	_background = qRgb(255, 255, 255);
+
+	_bits = 0;
+	_bytesPerLine = 0;
+	_width = 0;
+	_height = 0;
+	_pixelSize = 1.0;
+}
+
+// ==> ~SlicePlotter()
+// Destructor
+//--------------------------------------------------------------------
+SlicePlotter::~SlicePlotter()
+{
+}
+
+// ==> setPlane(axis, origin, extentH, extentV)
+// Plane perpendicular to the axis through the origin (the center of the plot)
+//--------------------------------------------------------------------
+void SlicePlotter::setPlane(int axis, const double origin[3], double extentH, double extentV)
+{
+	_axis = axis;
+	_horizontal = (axis == 0) ? 1 : 0;
+	_vertical = (axis == 2) ? 1 : 2;
+	for (int i = 0; i < 3; i++)
+		_origin[i] = origin[i];
+	_extentH = extentH;
+	_extentV = extentV;
+}
+
+// ==> setMaterials(materials)
+// Colors of the materials, a material with alpha 0 is not drawn (like the textures of the python parser)
+//--------------------------------------------------------------------
+void SlicePlotter::setMaterials(const std::map<int, Material*>& materials)
+{
+	_colors.clear();
+	std::map<int, Material*>::const_iterator iter;
+	for (iter = materials.begin(); iter != materials.end(); ++iter)
+		if (iter->second->getAlpha() > 0.0)
+			_colors[iter->first] = iter->second->getColor().rgb();
+}
+
+// ==> setVisibility(cells, universes)
+// Hidden cells and universes are not drawn
+//--------------------------------------------------------------------
+void SlicePlotter::setVisibility(const std::map<int, Cell*>& cells, const std::map<int, bool>& universes)
+{
+	_visibleCells.assign(_geometry->getCellCount(), true);
+	for (int i = 0; i < _geometry->getCellCount(); i++)
+	{
+		std::map<int, Cell*>::const_iterator iter = cells.find(_geometry->getCell(i)._number);
+		if (iter != cells.end())
+			_visibleCells[i] = iter->second->isVisible();
+	}
+	_universes = universes;
+}
+
+// ==> render(width, height)
+// Plot the plane to an image, the extents are scaled to fit in the image with square pixels
+// The pixels are classified by the threads, the outlines are drawn afterwards (they need the cells of the next row)
+//--------------------------------------------------------------------
+QImage SlicePlotter::render(int width, int height)
+{
+	QImage image(width, height, QImage::Format_RGB32);
+	image.fill(_background);
+	if (width <= 0 || height <= 0)
+		return image;
+
+	_bits = image.bits();
+	_bytesPerLine = image.bytesPerLine();
+	_width = width;
+	_height = height;
+	_pixelSize = std::max(2.0*_extentH/width, 2.0*_extentV/height);
+	_labels.assign(width*height, -1);
+	_nextRow = 0;
+
+	int threads = _threads > 0 ? _threads : QThread::idealThreadCount();
+	if (threads < 1)
+		threads = 1;
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+	for (int i = 0; i < threads; i++)
+		pool.start(new SlicePlotterTask(this));
+	pool.waitForDone();
+
+	if (_outlines)
+	{
+		QRgb outline = qRgb(0, 0, 0);
+		for (int row = 0; row < height; row++)
+		{
+			QRgb* line = (QRgb*)(_bits + row*_bytesPerLine);
+			const int* labels = &_labels[row*width];
+			for (int column = 0; column < width; column++)
+			{
+				if ((column + 1 < width && labels[column] != labels[column + 1])
+					|| (row + 1 < height && labels[column] != labels[column + width]))
+					line[column] = outline;
+			}
+		}
+	}
+
+	_bits = 0;
+	_labels.clear();
+	return image;
+}
+
+// ==> renderRows()
+// Classify the rows of the image that are not taken yet by another thread
+//--------------------------------------------------------------------
+void SlicePlotter::renderRows()
+{
+	std::vector<double> x(_width), y(_width), z(_width);
+	std::vector<int> columns(_width), cells(_width), rowLabels(_width);
+	std::vector<QRgb> colors(_width);
+	SenseBuffers buffers;
+	int row;
+	while ((row = _nextRow.fetchAndAddRelaxed(1)) < _height)
+	{
+		QRgb* line = (QRgb*)(_bits + row*_bytesPerLine);
+		int* labels = &_labels[row*_width];
+
+		// the pixels in the grid are looked up, the others are classified together
+		int count = 0;
+		double p[3] = { _origin[0], _origin[1], _origin[2] };
+		p[_vertical] = _origin[_vertical] + (0.5*_height - row - 0.5)*_pixelSize;
+		for (int column = 0; column < _width; column++)
+		{
+			p[_horizontal] = _origin[_horizontal] + (column + 0.5 - 0.5*_width)*_pixelSize;
+			int voxel;
+			if (_grid && _grid->findVoxel(p, voxel))
+			{
+				labels[column] = _grid->getLabel(voxel);
+				line[column] = classifyVoxel(voxel);
+			}
+			else
+			{
+				x[count] = p[0];
+				y[count] = p[1];
+				z[count] = p[2];
+				columns[count++] = column;
+			}
+		}
+		if (count == 0)
+			continue;
+		classify(&x[0], &y[0], &z[0], count, &cells[0], &rowLabels[0], &colors[0], buffers);
+		for (int i = 0; i < count; i++)
+		{
+			labels[columns[i]] = rowLabels[i];
+			line[columns[i]] = colors[i];
+		}
+	}
+}
+
+// ==> classify(x, y, z, count, cells, labels, colors, buffers)
+// Finds the index of the deepest cell that contains every point (-1 if there is none), the label of its path and its color
+// A filled cell or lattice element passes the point on to its universe (in the coordinates of the universe), the points
+// are found in a universe together (see Geometry::findCell for many points)
+// The labels are made like the labels of Geometry::locate (the pixels of a VoxelGrid have those), so the outlines are
+// also drawn between the lattice elements and the filled cells that have the same cell inside
+// The color is the background if the cell, one of the cells that it fills or one of their universes is not drawn
+//--------------------------------------------------------------------
+void SlicePlotter::classify(const double* x, const double* y, const double* z, int count, int* cells, int* labels, QRgb* colors, SenseBuffers& buffers) const
+{
+	std::vector<bool> visible(count, true);
+	std::vector<bool> filled(count, false);
+	std::vector<double> q(3*count);
+	std::vector<int> points;
+	_geometry->findCell(0, x, y, z, count, cells, buffers);
+	for (int i = 0; i < count; i++)
+	{
+		q[3*i] = x[i];
+		q[3*i + 1] = y[i];
+		q[3*i + 2] = z[i];
+		labels[i] = cells[i];
+		if (cells[i] != -1)
+			points.push_back(i);
+	}
+
+	std::vector<double> groupX, groupY, groupZ;
+	std::vector<int> groupCells;
+	for (int depth = 0; !points.empty(); depth++)
+	{
+		// the points in every universe (in its coordinates)
+		std::map<int, std::vector<int> > groups;
+		for (unsigned int n = 0; n < points.size(); n++)
+		{
+			int i = points[n];
+			visible[i] = visible[i] && isVisible(_geometry->getCell(cells[i]));
+			Transformation transformation;
+			int element;
+			int universe = _geometry->getFilling(cells[i], &q[3*i], transformation, &element);
+			if (depth < MAX_UNIVERSE_DEPTH && _geometry->isFilled(cells[i]))
+				labels[i] = Geometry::getLabel(labels[i], element);
+			if (universe == -1)
+				continue;
+			transformation.apply(&q[3*i], &q[3*i]);
+			std::map<int, bool>::const_iterator iter = _universes.find(universe);
+			visible[i] = visible[i] && (iter == _universes.end() || iter->second);
+			if (depth < MAX_UNIVERSE_DEPTH)
+				groups[universe].push_back(i);
+			else
+				filled[i] = true;
+		}
+
+		points.clear();
+		std::map<int, std::vector<int> >::const_iterator iter;
+		for (iter = groups.begin(); iter != groups.end(); ++iter)
+		{
+			const std::vector<int>& group = iter->second;
+			int size = group.size();
+			groupX.resize(size);
+			groupY.resize(size);
+			groupZ.resize(size);
+			groupCells.resize(size);
+			for (int n = 0; n < size; n++)
+			{
+				groupX[n] = q[3*group[n]];
+				groupY[n] = q[3*group[n] + 1];
+				groupZ[n] = q[3*group[n] + 2];
+			}
+			_geometry->findCell(iter->first, &groupX[0], &groupY[0], &groupZ[0], size, &groupCells[0], buffers);
+			for (int n = 0; n < size; n++)
+			{
+				labels[group[n]] = Geometry::getLabel(labels[group[n]], groupCells[n]);
+				if (groupCells[n] == -1)
+					filled[group[n]] = true;
+				else
+				{
+					cells[group[n]] = groupCells[n];
+					points.push_back(group[n]);
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		colors[i] = _background;
+		if (cells[i] != -1 && visible[i] && !filled[i])
+		{
+			std::map<int, QRgb>::const_iterator iter = _colors.find(_geometry->getCell(cells[i])._material);
+			if (iter != _colors.end())
+				colors[i] = iter->second;
+		}
+	}
+}
+
+// ==> classifyVoxel(voxel)
+// Returns the color of the voxel of the grid, like classify but only the visibility of the deepest cell and its
+// universe is known (the grid doesn't keep the filled cells above it)
+//--------------------------------------------------------------------
+QRgb SlicePlotter::classifyVoxel(int voxel) const
+{
+	int cell = _grid->getCell(voxel);
+	if (cell == -1 || !isVisible(_geometry->getCell(cell)))
+		return _background;
+	std::map<int, bool>::const_iterator universe = _universes.find(_geometry->getCell(cell)._universe);
+	if (universe != _universes.end() && !universe->second)
+		return _background;
+	std::map<int, QRgb>::const_iterator iter = _colors.find(_grid->getMaterial(voxel));
+	if (iter != _colors.end())
+		return iter->second;
+	return _background;
+}
+
+// ==> isVisible(cell)
+// Returns if the cell is drawn: not in the outside world (imp:n=0) and not hidden (see classify for the universes)
+//--------------------------------------------------------------------
+bool SlicePlotter::isVisible(const GeometryCell& cell) const
+{
+	return !cell._imp0 && _visibleCells[&cell - &_geometry->getCell(0)];
+}
@@ -0,0 +1,93 @@
+//#########################################################################################################
+//## SlicePlotter.h
+//#########################################################################################################
+//##
+//## Native 2D plotter of the Geometry, like the plotter of MCNP
+//## Every pixel of an axis aligned plane is classified into the cell that contains it (descending into
+//## filled cells and lattice elements) and gets the color of its material. Pixels on the border of two cells, also of two
+//## lattice elements or two filled cells with the same cells inside, are drawn as outlines. The rows of the image are divided over threads. With a VoxelGrid the pixels in the grid take the
+//## cell of their voxel (a lookup instead of a classification).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef SLICE_PLOTTER_H
+#define SLICE_PLOTTER_H
+
+#include <QImage>
+#include <QColor>
+#include <QAtomicInt>
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+#include "Geometry.h"
+#include "VoxelGrid.h"
+#include "Material.h"
+#include "Cell.h"
+
+class SlicePlotter
+{
+	public:
+		SlicePlotter(const Geometry* geometry);
+		~SlicePlotter();
+
+		// Plane perpendicular to the axis (0 = PX, 1 = PY, 2 = PZ) through the origin, which is the center of the plot
+		// The plot shows origin +/- extentH horizontally and origin +/- extentV vertically (MCNP's EXTENT eh ev), with
+		// the same horizontal and vertical axes as MCNP: y-z for PX, x-z for PY and x-y for PZ
+		void setPlane(int axis, const double origin[3], double extentH, double extentV);
+		// Colors of the materials, a material without color or with alpha 0 is not drawn
+		void setMaterials(const std::map<int, Material*>& materials);
+		// Hidden cells and universes are not drawn (see CameraManager::createSwitchesFile)
+		void setVisibility(const std::map<int, Cell*>& cells, const std::map<int, bool>& universes);
+		void setBackgroundColor(QColor color) { _background = color.rgb(); }
+		// Draw the borders between the cells
+		void setOutlines(bool outlines) { _outlines = outlines; }
+		// Number of threads (0 = number of cores)
+		void setThreads(int threads) { _threads = threads; }
+		// Look the pixels in the grid up in it (0 = classify every pixel)
+		void setVoxelGrid(const VoxelGrid* grid) { _grid = grid; }
+
+		// Plot the plane to an image
+		QImage render(int width, int height);
+
+		// Classify the rows of the image that are not taken yet (called by every thread)
+		void renderRows();
+
+	private:
+		void classify(const double* x, const double* y, const double* z, int count, int* cells, int* labels, QRgb* colors, SenseBuffers& buffers) const;
+		QRgb classifyVoxel(int voxel) const;
+		bool isVisible(const GeometryCell& cell) const;
+
+		const Geometry* _geometry;
+		const VoxelGrid* _grid;
+		int _threads;
+		bool _outlines;
+
+		// plane
+		int _axis;
+		int _horizontal;
+		int _vertical;
+		double _origin[3];
+		double _extentH;
+		double _extentV;
+		double _pixelSize;
+
+		// materials and visibility
+		std::map<int, QRgb> _colors;
+		std::vector<bool> _visibleCells;		// per cell index
+		std::map<int, bool> _universes;
+		QRgb _background;
+
+		// image that is plotted
+		uchar* _bits;
+		int _bytesPerLine;
+		int _width;
+		int _height;
+		std::vector<int> _labels;			// label of the path of every pixel (-1 if there is no cell, see Geometry::locate)
+		QAtomicInt _nextRow;
+};
+
+#endif
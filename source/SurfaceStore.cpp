@@ -0,0 +1,540 @@
+//#########################################################################################################
+//## SurfaceStore.cpp
+//#########################################################################################################
+//##
+//## The quadrics of all the surfaces of a Geometry in structure of arrays form (one array per coefficient)
+//## The kernels evaluate the sense of many points against one quadric or of one point against many quadrics
+//## per call, with SSE2 or AVX (chosen when the program starts, see SurfaceStoreKernels.h) and a scalar fallback.
+//## A quadric is stored as a plane, as a quadric without cross terms (spheres, cylinders and cones along the
+//## axes) or as a general quadric, the kernels for many points skip the coefficients that are zero. A torus
+//## (TX, TY, TZ) isn't a quadric: it is stored with its parameters and always evaluated by the scalar kernels.
+//## The coefficients are also kept one quadric after the other, for the tests of single points. The rows and
+//## slabs of points of the SlicePlotter and VoxelGrid are tested with the kernels (see Geometry::findCell).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "SurfaceStore.h"
+#include "Geometry.h"
+
+#include <QTime>
+
+#include <cmath>
+#include <algorithm>
+
+// AVX when the compiler targets it (i.e. -mavx or /arch:AVX), else SSE2 with AVX chosen at run time when the
+// processor has it (gcc, clang and msvc can compile functions for another instruction set)
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define SURFACE_STORE_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#include <immintrin.h>
+	#define SURFACE_STORE_SSE2
+	#if defined(__GNUC__) || defined(_MSC_VER)
+		#define SURFACE_STORE_AVX
+		#define SURFACE_STORE_AVX_DISPATCH
+	#endif
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#endif
+
+// number of quadrics in the benchmark of one point against many quadrics
+#define BENCHMARK_QUADRICS 1024
+
+//####################################################################
+//#  STORE
+//####################################################################
+
+// ==> SurfaceStore()
+// Constructor
+//--------------------------------------------------------------------
+SurfaceStore::SurfaceStore()
+{
+}
+
+// ==> ~SurfaceStore()
+// Destructor
+//--------------------------------------------------------------------
+SurfaceStore::~SurfaceStore()
+{
+}
+
+// ==> add(quadric)
+// Add a quadric, returns its index in the store
+//--------------------------------------------------------------------
+int SurfaceStore::add(const Quadric& quadric)
+{
+	for (int i = 0; i < 10; i++)
+	{
+		_c[i].push_back(quadric._c[i]);
+		_quadrics.push_back(quadric._c[i]);
+	}
+
+	const double* c = quadric._c;
+	if (c[0] == 0.0 && c[1] == 0.0 && c[2] == 0.0 && c[3] == 0.0 && c[4] == 0.0 && c[5] == 0.0)
+		_kinds.push_back(PLANE);
+	else if (c[3] == 0.0 && c[4] == 0.0 && c[5] == 0.0)
+		_kinds.push_back(DIAGONAL);
+	else
+		_kinds.push_back(GENERAL);
+	return _kinds.size() - 1;
+}
+
+// ==> addTorus(center, axis, r, a, b)
+// Add a torus, its coefficients are the parameters x, y, z, axis, r, a, b (the rest is zero)
+// The vector kernels don't evaluate it, see evaluateTorus
+//--------------------------------------------------------------------
+int SurfaceStore::addTorus(const double center[3], int axis, double r, double a, double b)
+{
+	double parameters[10] = { center[0], center[1], center[2], (double)axis, r, a, b, 0.0, 0.0, 0.0 };
+	for (int i = 0; i < 10; i++)
+	{
+		_c[i].push_back(parameters[i]);
+		_quadrics.push_back(parameters[i]);
+	}
+	_kinds.push_back(TORUS);
+	_tori.push_back(_kinds.size() - 1);
+	return _kinds.size() - 1;
+}
+
+// ==> clear()
+// Remove all quadrics
+//--------------------------------------------------------------------
+void SurfaceStore::clear()
+{
+	for (int i = 0; i < 10; i++)
+		_c[i].clear();
+	_quadrics.clear();
+	_kinds.clear();
+	_tori.clear();
+}
+
+// ==> evaluateTorus(index, p)
+// (t/a)^2 + ((s - r)/b)^2 - 1 with t the distance along the axis and s the distance to the axis (negative inside)
+//--------------------------------------------------------------------
+double SurfaceStore::evaluateTorus(int index, const double p[3]) const
+{
+	const double* c = &_quadrics[10*index];
+	int axis = (int)c[3];
+	double d[3] = { p[0] - c[0], p[1] - c[1], p[2] - c[2] };
+	double t = d[axis];
+	double s = std::sqrt(d[(axis + 1) % 3]*d[(axis + 1) % 3] + d[(axis + 2) % 3]*d[(axis + 2) % 3]);
+	return (t*t)/(c[5]*c[5]) + (s - c[4])*(s - c[4])/(c[6]*c[6]) - 1.0;
+}
+
+// ==> evaluateTori(p, first, count, values, senses)
+// Overwrite the values or senses (if not 0) of the tori among the quadrics first .. first + count - 1, the kernels
+// of many quadrics evaluate the parameters of a torus as if they were coefficients
+//--------------------------------------------------------------------
+void SurfaceStore::evaluateTori(const double p[3], int first, int count, double* values, unsigned char* senses) const
+{
+	std::vector<int>::const_iterator iter = std::lower_bound(_tori.begin(), _tori.end(), first);
+	for (; iter != _tori.end() && *iter < first + count; ++iter)
+	{
+		double value = evaluateTorus(*iter, p);
+		if (values != 0)
+			values[*iter - first] = value;
+		if (senses != 0)
+			senses[*iter - first] = value < 0.0;
+	}
+}
+
+//####################################################################
+//#  SCALAR KERNELS
+//####################################################################
+
+// ==> evaluatePointsScalar(index, x, y, z, count, values)
+// Values of the quadric (index) in the points (x[i], y[i], z[i])
+//--------------------------------------------------------------------
+void SurfaceStore::evaluatePointsScalar(int index, const double* x, const double* y, const double* z, int count, double* values) const
+{
+	double a = _c[0][index], b = _c[1][index], c = _c[2][index], d = _c[3][index], e = _c[4][index];
+	double f = _c[5][index], g = _c[6][index], h = _c[7][index], j = _c[8][index], k = _c[9][index];
+	switch (_kinds[index])
+	{
+		case PLANE:
+			for (int i = 0; i < count; i++)
+				values[i] = g*x[i] + h*y[i] + j*z[i] + k;
+			break;
+		case DIAGONAL:
+			for (int i = 0; i < count; i++)
+				values[i] = x[i]*(a*x[i] + g) + y[i]*(b*y[i] + h) + z[i]*(c*z[i] + j) + k;
+			break;
+		case TORUS:
+			for (int i = 0; i < count; i++)
+			{
+				double p[3] = { x[i], y[i], z[i] };
+				values[i] = evaluateTorus(index, p);
+			}
+			break;
+		default:
+			for (int i = 0; i < count; i++)
+				values[i] = x[i]*(a*x[i] + d*y[i] + g) + y[i]*(b*y[i] + e*z[i] + h) + z[i]*(c*z[i] + f*x[i] + j) + k;
+			break;
+	}
+}
+
+// ==> sensePointsScalar(index, x, y, z, count, senses)
+// Senses of the points against the quadric (1 where it is negative)
+//--------------------------------------------------------------------
+void SurfaceStore::sensePointsScalar(int index, const double* x, const double* y, const double* z, int count, unsigned char* senses) const
+{
+	double values[256];
+	for (int first = 0; first < count; first += 256)
+	{
+		int n = std::min(256, count - first);
+		evaluatePointsScalar(index, x + first, y + first, z + first, n, values);
+		for (int i = 0; i < n; i++)
+			senses[first + i] = values[i] < 0.0;
+	}
+}
+
+// ==> evaluateQuadricsScalar(p, first, count, values)
+// Values of the quadrics first .. first + count - 1 in the point
+//--------------------------------------------------------------------
+void SurfaceStore::evaluateQuadricsScalar(const double p[3], int first, int count, double* values) const
+{
+	const double x = p[0], y = p[1], z = p[2];
+	const double* a = &_c[0][first]; const double* b = &_c[1][first]; const double* c = &_c[2][first];
+	const double* d = &_c[3][first]; const double* e = &_c[4][first]; const double* f = &_c[5][first];
+	const double* g = &_c[6][first]; const double* h = &_c[7][first]; const double* j = &_c[8][first];
+	const double* k = &_c[9][first];
+	for (int i = 0; i < count; i++)
+		values[i] = x*(a[i]*x + d[i]*y + g[i]) + y*(b[i]*y + e[i]*z + h[i]) + z*(c[i]*z + f[i]*x + j[i]) + k[i];
+	evaluateTori(p, first, count, values, 0);
+}
+
+// ==> senseQuadricsScalar(p, first, count, senses)
+// Senses of the point against the quadrics first .. first + count - 1 (1 where they are negative)
+//--------------------------------------------------------------------
+void SurfaceStore::senseQuadricsScalar(const double p[3], int first, int count, unsigned char* senses) const
+{
+	double values[256];
+	for (int offset = 0; offset < count; offset += 256)
+	{
+		int n = std::min(256, count - offset);
+		evaluateQuadricsScalar(p, first + offset, n, values);
+		for (int i = 0; i < n; i++)
+			senses[offset + i] = values[i] < 0.0;
+	}
+}
+
+//####################################################################
+//#  VECTOR KERNELS
+//####################################################################
+
+// The SSE2 kernels (every x86-64 processor has SSE2, the AVX kernels are compiled for the processors that have AVX
+// and chosen when the program starts)
+#if defined(SURFACE_STORE_SSE2)
+	#define VECTOR_WIDTH 2
+	typedef __m128d Vector;
+	#define VECTOR_SET(a) _mm_set1_pd(a)
+	#define VECTOR_LOAD(p) _mm_loadu_pd(p)
+	#define VECTOR_STORE(p, a) _mm_storeu_pd(p, a)
+	#define VECTOR_ADD(a, b) _mm_add_pd(a, b)
+	#define VECTOR_MUL(a, b) _mm_mul_pd(a, b)
+	#define VECTOR_NEGATIVE(a) _mm_movemask_pd(_mm_cmplt_pd(a, _mm_setzero_pd()))
+	#define VECTOR_FINISH()
+	#define KERNEL(name) name##Sse2
+	#include "SurfaceStoreKernels.h"
+	#undef VECTOR_WIDTH
+	#undef VECTOR_SET
+	#undef VECTOR_LOAD
+	#undef VECTOR_STORE
+	#undef VECTOR_ADD
+	#undef VECTOR_MUL
+	#undef VECTOR_NEGATIVE
+	#undef VECTOR_FINISH
+	#undef KERNEL
+#endif
+
+// The AVX kernels, without FMA: a fused multiply add rounds differently than the single point tests
+#if defined(SURFACE_STORE_AVX)
+	#if defined(SURFACE_STORE_AVX_DISPATCH) && defined(__clang__)
+		#pragma clang attribute push (__attribute__((target("avx"))), apply_to = function)
+	#elif defined(SURFACE_STORE_AVX_DISPATCH) && defined(__GNUC__)
+		#pragma GCC push_options
+		#pragma GCC target("avx")
+	#endif
+	#define VECTOR_WIDTH 4
+	typedef __m256d VectorAvx;
+	#define Vector VectorAvx
+	#define VECTOR_SET(a) _mm256_set1_pd(a)
+	#define VECTOR_LOAD(p) _mm256_loadu_pd(p)
+	#define VECTOR_STORE(p, a) _mm256_storeu_pd(p, a)
+	#define VECTOR_ADD(a, b) _mm256_add_pd(a, b)
+	#define VECTOR_MUL(a, b) _mm256_mul_pd(a, b)
+	#define VECTOR_NEGATIVE(a) _mm256_movemask_pd(_mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_LT_OQ))
+	#define VECTOR_FINISH() _mm256_zeroupper()
+	#define KERNEL(name) name##Avx
+	#include "SurfaceStoreKernels.h"
+	#undef Vector
+	#undef VECTOR_WIDTH
+	#undef VECTOR_SET
+	#undef VECTOR_LOAD
+	#undef VECTOR_STORE
+	#undef VECTOR_ADD
+	#undef VECTOR_MUL
+	#undef VECTOR_NEGATIVE
+	#undef VECTOR_FINISH
+	#undef KERNEL
+	#if defined(SURFACE_STORE_AVX_DISPATCH) && defined(__clang__)
+		#pragma clang attribute pop
+	#elif defined(SURFACE_STORE_AVX_DISPATCH) && defined(__GNUC__)
+		#pragma GCC pop_options
+	#endif
+#endif
+
+// ==> hasAvx()
+// Returns if the processor and the operating system support AVX
+//--------------------------------------------------------------------
+static bool hasAvx()
+{
+#if defined(SURFACE_STORE_AVX_DISPATCH) && defined(__GNUC__)
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx");
+#elif defined(SURFACE_STORE_AVX_DISPATCH) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	return osxsave && avx && (_xgetbv(0) & 6) == 6;
+#elif defined(SURFACE_STORE_AVX)
+	return true;
+#else
+	return false;
+#endif
+}
+
+// the instruction set of the vector kernels, chosen once
+static const bool useAvx = hasAvx();
+
+// ==> evaluatePoints(index, x, y, z, count, values)
+// Values of the quadric (index) in the points (x[i], y[i], z[i])
+//--------------------------------------------------------------------
+void SurfaceStore::evaluatePoints(int index, const double* x, const double* y, const double* z, int count, double* values) const
+{
+	int i = 0;
+#if defined(SURFACE_STORE_AVX)
+	if (useAvx && _kinds[index] != TORUS)
+		i = evaluatePointsAvx(&_quadrics[10*index], _kinds[index], x, y, z, count, values);
+#endif
+#if defined(SURFACE_STORE_SSE2)
+	if (!useAvx && _kinds[index] != TORUS)
+		i = evaluatePointsSse2(&_quadrics[10*index], _kinds[index], x, y, z, count, values);
+#endif
+	if (i < count)
+		evaluatePointsScalar(index, x + i, y + i, z + i, count - i, values + i);
+}
+
+// ==> sensePoints(index, x, y, z, count, senses)
+// Senses of the points against the quadric (1 where it is negative)
+//--------------------------------------------------------------------
+void SurfaceStore::sensePoints(int index, const double* x, const double* y, const double* z, int count, unsigned char* senses) const
+{
+	int i = 0;
+#if defined(SURFACE_STORE_AVX)
+	if (useAvx && _kinds[index] != TORUS)
+		i = sensePointsAvx(&_quadrics[10*index], _kinds[index], x, y, z, count, senses);
+#endif
+#if defined(SURFACE_STORE_SSE2)
+	if (!useAvx && _kinds[index] != TORUS)
+		i = sensePointsSse2(&_quadrics[10*index], _kinds[index], x, y, z, count, senses);
+#endif
+	if (i < count)
+		sensePointsScalar(index, x + i, y + i, z + i, count - i, senses + i);
+}
+
+// ==> evaluateQuadrics(p, first, count, values)
+// Values of the quadrics first .. first + count - 1 in the point
+//--------------------------------------------------------------------
+void SurfaceStore::evaluateQuadrics(const double p[3], int first, int count, double* values) const
+{
+	int i = 0;
+#if defined(SURFACE_STORE_AVX) || defined(SURFACE_STORE_SSE2)
+	const double* c[10];
+	for (int n = 0; n < 10; n++)
+		c[n] = &_c[n][first];
+#endif
+#if defined(SURFACE_STORE_AVX)
+	if (useAvx)
+		i = evaluateQuadricsAvx(c, p, count, values);
+#endif
+#if defined(SURFACE_STORE_SSE2)
+	if (!useAvx)
+		i = evaluateQuadricsSse2(c, p, count, values);
+#endif
+	if (i < count)
+		evaluateQuadricsScalar(p, first + i, count - i, values + i);
+	evaluateTori(p, first, i, values, 0);
+}
+
+// ==> senseQuadrics(p, first, count, senses)
+// Senses of the point against the quadrics first .. first + count - 1 (1 where they are negative)
+//--------------------------------------------------------------------
+void SurfaceStore::senseQuadrics(const double p[3], int first, int count, unsigned char* senses) const
+{
+	int i = 0;
+#if defined(SURFACE_STORE_AVX) || defined(SURFACE_STORE_SSE2)
+	const double* c[10];
+	for (int n = 0; n < 10; n++)
+		c[n] = &_c[n][first];
+#endif
+#if defined(SURFACE_STORE_AVX)
+	if (useAvx)
+		i = senseQuadricsAvx(c, p, count, senses);
+#endif
+#if defined(SURFACE_STORE_SSE2)
+	if (!useAvx)
+		i = senseQuadricsSse2(c, p, count, senses);
+#endif
+	if (i < count)
+		senseQuadricsScalar(p, first + i, count - i, senses + i);
+	evaluateTori(p, first, i, 0, senses);
+}
+
+// ==> getInstructionSet()
+// Returns the vector instructions of the kernels on this processor ("AVX", "SSE2" or "none")
+//--------------------------------------------------------------------
+QString SurfaceStore::getInstructionSet()
+{
+	if (useAvx)
+		return "AVX";
+#if defined(SURFACE_STORE_SSE2)
+	return "SSE2";
+#else
+	return "none";
+#endif
+}
+
+//####################################################################
+//#  BENCHMARK
+//####################################################################
+
+// ==> randomCoordinate(seed)
+// Deterministic pseudo random number in [-10, 10) (linear congruential generator)
+//--------------------------------------------------------------------
+static double randomCoordinate(unsigned int& seed)
+{
+	seed = seed*1664525u + 1013904223u;
+	return 20.0*(seed >> 8)/16777216.0 - 10.0;
+}
+
+// ==> benchmarkLine(name, scalarTime, vectorTime, evaluations, mismatches)
+// One line of the report: nanoseconds per evaluation of both kernels and the speedup
+//--------------------------------------------------------------------
+static QString benchmarkLine(QString name, int scalarTime, int vectorTime, double evaluations, int mismatches)
+{
+	QString line = name.leftJustified(32);
+	line += QString("scalar %1 ns   vector %2 ns   ").arg(1.0e6*scalarTime/evaluations, 0, 'f', 3).arg(1.0e6*vectorTime/evaluations, 0, 'f', 3);
+	if (vectorTime > 0)
+		line += QString("speedup %1").arg((double)scalarTime/vectorTime, 0, 'f', 2);
+	if (mismatches > 0)
+		line += QString("   %1 senses differ").arg(mismatches);
+	return line + "\n";
+}
+
+// ==> benchmark(points, repeats)
+// Time the sense kernels of many points against a plane, a sphere, a cylinder on an axis, a tilted cylinder
+// (a general quadric) and a torus (always scalar) and of one point against many quadrics, the vector kernels must
+// give the same senses
+//--------------------------------------------------------------------
+QString SurfaceStore::benchmark(int points, int repeats)
+{
+	if (points < 1)
+		points = 1;
+	if (repeats < 1)
+		repeats = 1;
+
+	unsigned int seed = 12345;
+	std::vector<double> x(points), y(points), z(points);
+	for (int i = 0; i < points; i++)
+	{
+		x[i] = randomCoordinate(seed);
+		y[i] = randomCoordinate(seed);
+		z[i] = randomCoordinate(seed);
+	}
+
+	SurfaceStore store;
+	const char* names[5] = { "plane (P)", "sphere (S)", "cylinder (CZ)", "tilted cylinder (GQ)", "torus (TZ)" };
+	double axis[3] = { 1.0, 1.0, 1.0 };
+	double m[3][3], l[3] = { 0.0, 0.0, 0.0 };
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			m[i][j] = (i == j ? 1.0 : 0.0) - axis[i]*axis[j]/3.0;
+	Quadric quadrics[4];
+	quadrics[0] = Quadric::plane(1.0, 2.0, 3.0, 1.0);
+	quadrics[1]._c[0] = quadrics[1]._c[1] = quadrics[1]._c[2] = 1.0;
+	quadrics[1]._c[9] = -25.0;
+	quadrics[2]._c[0] = quadrics[2]._c[1] = 1.0;
+	quadrics[2]._c[9] = -16.0;
+	quadrics[3] = Quadric::fromMatrix(m, l, -16.0);
+	for (int i = 0; i < 4; i++)
+		store.add(quadrics[i]);
+	double origin[3] = { 0.0, 0.0, 0.0 };
+	store.addTorus(origin, 2, 6.0, 2.0, 3.0);
+
+	QString report = "Surface kernels (vector instructions: " + getInstructionSet() + ")\n";
+	std::vector<unsigned char> scalarSenses(points), vectorSenses(points);
+	QTime time;
+	for (int n = 0; n < 5; n++)
+	{
+		time.start();
+		for (int r = 0; r < repeats; r++)
+			store.sensePointsScalar(n, &x[0], &y[0], &z[0], points, &scalarSenses[0]);
+		int scalarTime = time.elapsed();
+		time.start();
+		for (int r = 0; r < repeats; r++)
+			store.sensePoints(n, &x[0], &y[0], &z[0], points, &vectorSenses[0]);
+		int vectorTime = time.elapsed();
+
+		int mismatches = 0;
+		for (int i = 0; i < points; i++)
+			mismatches += scalarSenses[i] != vectorSenses[i];
+		report += benchmarkLine(QString("points / ") + names[n], scalarTime, vectorTime, (double)points*repeats, mismatches);
+	}
+
+	// one point against many quadrics of all kinds
+	store.clear();
+	for (int i = 0; i < BENCHMARK_QUADRICS; i++)
+	{
+		Quadric quadric = quadrics[i % 4];
+		double center[3] = { randomCoordinate(seed), randomCoordinate(seed), randomCoordinate(seed) };
+		quadric.translate(center);
+		store.add(quadric);
+	}
+	int count = std::max(1, points/BENCHMARK_QUADRICS);
+	scalarSenses.resize(BENCHMARK_QUADRICS);
+	vectorSenses.resize(BENCHMARK_QUADRICS);
+	time.start();
+	for (int r = 0; r < repeats; r++)
+		for (int i = 0; i < count; i++)
+		{
+			double p[3] = { x[i], y[i], z[i] };
+			store.senseQuadricsScalar(p, 0, BENCHMARK_QUADRICS, &scalarSenses[0]);
+		}
+	int scalarTime = time.elapsed();
+	time.start();
+	for (int r = 0; r < repeats; r++)
+		for (int i = 0; i < count; i++)
+		{
+			double p[3] = { x[i], y[i], z[i] };
+			store.senseQuadrics(p, 0, BENCHMARK_QUADRICS, &vectorSenses[0]);
+		}
+	int vectorTime = time.elapsed();
+
+	int mismatches = 0;
+	for (int i = 0; i < count; i++)
+	{
+		double p[3] = { x[i], y[i], z[i] };
+		store.senseQuadricsScalar(p, 0, BENCHMARK_QUADRICS, &scalarSenses[0]);
+		store.senseQuadrics(p, 0, BENCHMARK_QUADRICS, &vectorSenses[0]);
+		for (int n = 0; n < BENCHMARK_QUADRICS; n++)
+			mismatches += scalarSenses[n] != vectorSenses[n];
+	}
+	report += benchmarkLine("quadrics / mixed", scalarTime, vectorTime, (double)count*repeats*BENCHMARK_QUADRICS, mismatches);
+	return report;
+}
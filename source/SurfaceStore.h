@@ -0,0 +1,82 @@
+//#########################################################################################################
+//## SurfaceStore.h
+//#########################################################################################################
+//##
+//## The quadrics of all the surfaces of a Geometry in structure of arrays form (one array per coefficient)
+//## The kernels evaluate the sense of many points against one quadric or of one point against many quadrics
+//## per call, with SSE2 or AVX (chosen when the program starts, see SurfaceStoreKernels.h) and a scalar fallback.
+//## A quadric is stored as a plane, as a quadric without cross terms (spheres, cylinders and cones along the
+//## axes) or as a general quadric, the kernels for many points skip the coefficients that are zero. A torus
+//## (TX, TY, TZ) isn't a quadric: it is stored with its parameters and always evaluated by the scalar kernels.
+//## The coefficients are also kept one quadric after the other, for the tests of single points. The rows and
+//## slabs of points of the SlicePlotter and VoxelGrid are tested with the kernels (see Geometry::findCell).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef SURFACE_STORE_H
+#define SURFACE_STORE_H
+
+#include <QString>
+
+#include <iostream>
+#include <vector>
+
+struct Quadric;
+
+class SurfaceStore
+{
+	public:
+		enum Kind { PLANE, DIAGONAL, GENERAL, TORUS };
+
+		SurfaceStore();
+		~SurfaceStore();
+
+		// Add a quadric, returns its index in the store
+		int add(const Quadric& quadric);
+		// Add a torus around the axis (0 = x, 1 = y, 2 = z) through the center, of radius r and with the semi-axes
+		// a (along the axis) and b of its ellipse (see MCNPX TX, TY, TZ), returns its index in the store
+		int addTorus(const double center[3], int axis, double r, double a, double b);
+		void clear();
+		int getCount() const { return _kinds.size(); }
+		Kind getKind(int index) const { return (Kind)_kinds[index]; }
+
+		// Value of one quadric in one point (from the interleaved copy of the coefficients)
+		double evaluate(int index, const double p[3]) const
+		{
+			if (_kinds[index] == TORUS)
+				return evaluateTorus(index, p);
+			const double* c = &_quadrics[10*index];
+			return p[0]*(c[0]*p[0] + c[3]*p[1] + c[6]) + p[1]*(c[1]*p[1] + c[4]*p[2] + c[7]) + p[2]*(c[2]*p[2] + c[5]*p[0] + c[8]) + c[9];
+		}
+
+		// Values and senses (1 for the inside, where the quadric is negative) of many points against one quadric
+		void evaluatePoints(int index, const double* x, const double* y, const double* z, int count, double* values) const;
+		void sensePoints(int index, const double* x, const double* y, const double* z, int count, unsigned char* senses) const;
+		// Values and senses of one point against the quadrics first .. first + count - 1
+		void evaluateQuadrics(const double p[3], int first, int count, double* values) const;
+		void senseQuadrics(const double p[3], int first, int count, unsigned char* senses) const;
+
+		// The same kernels without vector instructions
+		void evaluatePointsScalar(int index, const double* x, const double* y, const double* z, int count, double* values) const;
+		void sensePointsScalar(int index, const double* x, const double* y, const double* z, int count, unsigned char* senses) const;
+		void evaluateQuadricsScalar(const double p[3], int first, int count, double* values) const;
+		void senseQuadricsScalar(const double p[3], int first, int count, unsigned char* senses) const;
+
+		// Returns the vector instructions of the kernels on this processor ("AVX", "SSE2" or "none")
+		static QString getInstructionSet();
+		// Time the scalar and vector kernels per kind of quadric, returns a report (one line per kernel)
+		static QString benchmark(int points = 65536, int repeats = 100);
+
+	private:
+		double evaluateTorus(int index, const double p[3]) const;
+		void evaluateTori(const double p[3], int first, int count, double* values, unsigned char* senses) const;
+
+		std::vector<double> _c[10];			// A, B, C, D, E, F, G, H, J, K of every quadric (the parameters of a torus)
+		std::vector<double> _quadrics;		// the same coefficients, one quadric after the other
+		std::vector<unsigned char> _kinds;
+		std::vector<int> _tori;				// indices of the tori (in increasing order)
+};
+
+#endif
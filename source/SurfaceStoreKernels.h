@@ -0,0 +1,136 @@
+//#########################################################################################################
+//## SurfaceStoreKernels.h
+//#########################################################################################################
+//##
+//## The vector kernels of the SurfaceStore, written once for every instruction set: SurfaceStore.cpp includes
+//## this file once per set, with Vector, VECTOR_WIDTH, the VECTOR_ macros and KERNEL(name) (the name with the
+//## suffix of the set) defined. Every kernel handles the multiple of VECTOR_WIDTH and returns how many points or
+//## quadrics it did, the rest is left to the scalar kernels. The sums are added in the same order as
+//## SurfaceStore::evaluate, so the senses of the kernels are the same as the ones of the single point tests.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+// ==> evaluatePlane(c, x, y, z)
+// Gx + Hy + Jz + K for VECTOR_WIDTH points
+//--------------------------------------------------------------------
+static inline Vector KERNEL(evaluatePlane)(const Vector* c, Vector x, Vector y, Vector z)
+{
+	return VECTOR_ADD(VECTOR_ADD(VECTOR_ADD(VECTOR_MUL(x, c[6]), VECTOR_MUL(y, c[7])), VECTOR_MUL(z, c[8])), c[9]);
+}
+
+// ==> evaluateDiagonal(c, x, y, z)
+// x(Ax + G) + y(By + H) + z(Cz + J) + K for VECTOR_WIDTH points
+//--------------------------------------------------------------------
+static inline Vector KERNEL(evaluateDiagonal)(const Vector* c, Vector x, Vector y, Vector z)
+{
+	Vector value = VECTOR_ADD(VECTOR_MUL(x, VECTOR_ADD(VECTOR_MUL(c[0], x), c[6])), VECTOR_MUL(y, VECTOR_ADD(VECTOR_MUL(c[1], y), c[7])));
+	value = VECTOR_ADD(value, VECTOR_MUL(z, VECTOR_ADD(VECTOR_MUL(c[2], z), c[8])));
+	return VECTOR_ADD(value, c[9]);
+}
+
+// ==> evaluateGeneral(a, b, c, d, e, f, g, h, j, k, x, y, z)
+// x(Ax + Dy + G) + y(By + Ez + H) + z(Cz + Fx + J) + K for VECTOR_WIDTH points or quadrics
+//--------------------------------------------------------------------
+static inline Vector KERNEL(evaluateGeneral)(Vector a, Vector b, Vector c, Vector d, Vector e, Vector f, Vector g, Vector h,
+					Vector j, Vector k, Vector x, Vector y, Vector z)
+{
+	Vector value = VECTOR_MUL(x, VECTOR_ADD(VECTOR_ADD(VECTOR_MUL(a, x), VECTOR_MUL(d, y)), g));
+	value = VECTOR_ADD(value, VECTOR_MUL(y, VECTOR_ADD(VECTOR_ADD(VECTOR_MUL(b, y), VECTOR_MUL(e, z)), h)));
+	value = VECTOR_ADD(value, VECTOR_MUL(z, VECTOR_ADD(VECTOR_ADD(VECTOR_MUL(c, z), VECTOR_MUL(f, x)), j)));
+	return VECTOR_ADD(value, k);
+}
+
+// ==> evaluateVectors(kind, c, x, y, z)
+// Value of a quadric of the kind for VECTOR_WIDTH points
+//--------------------------------------------------------------------
+static inline Vector KERNEL(evaluateVectors)(int kind, const Vector* c, const double* x, const double* y, const double* z)
+{
+	Vector vx = VECTOR_LOAD(x);
+	Vector vy = VECTOR_LOAD(y);
+	Vector vz = VECTOR_LOAD(z);
+	if (kind == SurfaceStore::PLANE)
+		return KERNEL(evaluatePlane)(c, vx, vy, vz);
+	if (kind == SurfaceStore::DIAGONAL)
+		return KERNEL(evaluateDiagonal)(c, vx, vy, vz);
+	return KERNEL(evaluateGeneral)(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], vx, vy, vz);
+}
+
+// ==> evaluateQuadricVectors(c, i, x, y, z)
+// Values of VECTOR_WIDTH quadrics (starting at i in the coefficient arrays c) for one point
+//--------------------------------------------------------------------
+static inline Vector KERNEL(evaluateQuadricVectors)(const double* const* c, int i, Vector x, Vector y, Vector z)
+{
+	return KERNEL(evaluateGeneral)(VECTOR_LOAD(c[0] + i), VECTOR_LOAD(c[1] + i), VECTOR_LOAD(c[2] + i), VECTOR_LOAD(c[3] + i),
+				VECTOR_LOAD(c[4] + i), VECTOR_LOAD(c[5] + i), VECTOR_LOAD(c[6] + i), VECTOR_LOAD(c[7] + i), VECTOR_LOAD(c[8] + i),
+				VECTOR_LOAD(c[9] + i), x, y, z);
+}
+
+// ==> evaluatePoints(coefficients, kind, x, y, z, count, values)
+// Values of the quadric (its 10 coefficients) in the points, returns the number of points that are done
+//--------------------------------------------------------------------
+static int KERNEL(evaluatePoints)(const double* coefficients, int kind, const double* x, const double* y, const double* z, int count, double* values)
+{
+	Vector c[10];
+	for (int n = 0; n < 10; n++)
+		c[n] = VECTOR_SET(coefficients[n]);
+	int i = 0;
+	for (; i + VECTOR_WIDTH <= count; i += VECTOR_WIDTH)
+		VECTOR_STORE(values + i, KERNEL(evaluateVectors)(kind, c, x + i, y + i, z + i));
+	VECTOR_FINISH();
+	return i;
+}
+
+// ==> sensePoints(coefficients, kind, x, y, z, count, senses)
+// Senses of the points against the quadric (1 where it is negative), returns the number of points that are done
+//--------------------------------------------------------------------
+static int KERNEL(sensePoints)(const double* coefficients, int kind, const double* x, const double* y, const double* z, int count, unsigned char* senses)
+{
+	Vector c[10];
+	for (int n = 0; n < 10; n++)
+		c[n] = VECTOR_SET(coefficients[n]);
+	int i = 0;
+	for (; i + VECTOR_WIDTH <= count; i += VECTOR_WIDTH)
+	{
+		int mask = VECTOR_NEGATIVE(KERNEL(evaluateVectors)(kind, c, x + i, y + i, z + i));
+		for (int n = 0; n < VECTOR_WIDTH; n++)
+			senses[i + n] = (mask >> n) & 1;
+	}
+	VECTOR_FINISH();
+	return i;
+}
+
+// ==> evaluateQuadrics(c, p, count, values)
+// Values of the quadrics (the coefficient arrays c start at the first one) in the point, returns the number that are done
+//--------------------------------------------------------------------
+static int KERNEL(evaluateQuadrics)(const double* const* c, const double p[3], int count, double* values)
+{
+	Vector x = VECTOR_SET(p[0]);
+	Vector y = VECTOR_SET(p[1]);
+	Vector z = VECTOR_SET(p[2]);
+	int i = 0;
+	for (; i + VECTOR_WIDTH <= count; i += VECTOR_WIDTH)
+		VECTOR_STORE(values + i, KERNEL(evaluateQuadricVectors)(c, i, x, y, z));
+	VECTOR_FINISH();
+	return i;
+}
+
+// ==> senseQuadrics(c, p, count, senses)
+// Senses of the point against the quadrics (1 where they are negative), returns the number that are done
+//--------------------------------------------------------------------
+static int KERNEL(senseQuadrics)(const double* const* c, const double p[3], int count, unsigned char* senses)
+{
+	Vector x = VECTOR_SET(p[0]);
+	Vector y = VECTOR_SET(p[1]);
+	Vector z = VECTOR_SET(p[2]);
+	int i = 0;
+	for (; i + VECTOR_WIDTH <= count; i += VECTOR_WIDTH)
+	{
+		int mask = VECTOR_NEGATIVE(KERNEL(evaluateQuadricVectors)(c, i, x, y, z));
+		for (int n = 0; n < VECTOR_WIDTH; n++)
+			senses[i + n] = (mask >> n) & 1;
+	}
+	VECTOR_FINISH();
+	return i;
+}
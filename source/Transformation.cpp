@@ -0,0 +1,286 @@
+//#########################################################################################################
+//## Transformation.cpp
+//#########################################################################################################
+//##
+//## The transformations of a mcnpx file (TRn and *TRn cards, TRCL and FILL transformations) as affine maps
+//## from the main coordinates to the auxiliary coordinates: x' = R x + b, kept as a 3x4 matrix together
+//## with its inverse. A TR card is resolved once (see Transformation::fromCard), the transformations of
+//## nested universes are composed from these matrices, so a point or ray only pays the multiplications.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "Transformation.h"
+
+#include <cmath>
+
+#define PI 3.14159265358979323846
+
+//####################################################################
+//#  TRANSFORMATION
+//####################################################################
+
+// ==> Transformation()
+// Constructor, the identity
+//--------------------------------------------------------------------
+Transformation::Transformation()
+{
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 4; j++)
+		{
+			_forward[i][j] = (i == j) ? 1.0 : 0.0;
+			_inverse[i][j] = (i == j) ? 1.0 : 0.0;
+		}
+}
+
+// ==> normalize(v)
+// Scale the vector to length 1, returns false if it has no length
+//--------------------------------------------------------------------
+static bool normalize(double v[3])
+{
+	double length = std::sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+	if (length < 1e-12)
+		return false;
+	for (int i = 0; i < 3; i++)
+		v[i] /= length;
+	return true;
+}
+
+// ==> cross(a, b, c)
+// c = a x b
+//--------------------------------------------------------------------
+static void cross(const double a[3], const double b[3], double c[3])
+{
+	c[0] = a[1]*b[2] - a[2]*b[1];
+	c[1] = a[2]*b[0] - a[0]*b[2];
+	c[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+// ==> orthogonalize(row, previous)
+// Remove the component along the (unit) vector previous from row
+//--------------------------------------------------------------------
+static void orthogonalize(double row[3], const double previous[3])
+{
+	double dot = row[0]*previous[0] + row[1]*previous[1] + row[2]*previous[2];
+	for (int i = 0; i < 3; i++)
+		row[i] -= dot*previous[i];
+}
+
+// ==> fromCard(data, degrees, transformation)
+// Resolve the data of a TR card: o1 o2 o3 xx' yx' zx' xy' yy' zy' xz' yz' zz' m, with the angles in degrees for *TR
+// The rows of R are the auxiliary axes in main coordinates, x' = R (x - o) for m = 1 (the default) and
+// x' = R x + o for m = -1. The rotation is given by all 9 entries, by 6 (x' and y', z' = x' cross y') or by 3 (x',
+// the other axes arbitrary) and is made orthonormal (like MCNPX does). Without rotation it is only a translation.
+// Returns false if the number of entries is not supported (5 entries, i.e. one vector in each system)
+//--------------------------------------------------------------------
+bool Transformation::fromCard(const std::vector<double>& data, bool degrees, Transformation& transformation)
+{
+	int count = data.size();
+	if (count < 3)
+		return false;
+	int entries = count - 3;
+	bool hasM = (entries == 1 || entries == 4 || entries == 7 || entries == 10);
+	if (hasM)
+		entries--;
+	if (entries != 0 && entries != 3 && entries != 6 && entries != 9)
+		return false;
+
+	double r[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+	for (int n = 0; n < entries; n++)
+	{
+		double value = data[3 + n];
+		r[n/3][n%3] = degrees ? std::cos(value*PI/180.0) : value;
+	}
+
+	if (entries != 0)
+	{
+		if (!normalize(r[0]))
+			return false;
+		if (entries == 3)
+		{
+			// any axis perpendicular to x'
+			int smallest = 0;
+			for (int i = 1; i < 3; i++)
+				if (std::fabs(r[0][i]) < std::fabs(r[0][smallest]))
+					smallest = i;
+			double axis[3] = { 0.0, 0.0, 0.0 };
+			axis[smallest] = 1.0;
+			cross(r[0], axis, r[1]);
+		}
+		orthogonalize(r[1], r[0]);
+		if (!normalize(r[1]))
+			return false;
+		if (entries == 9)
+		{
+			orthogonalize(r[2], r[0]);
+			orthogonalize(r[2], r[1]);
+			if (!normalize(r[2]))
+				return false;
+		}
+		else
+			cross(r[0], r[1], r[2]);
+	}
+
+	bool inverse = hasM && data[count - 1] < 0;
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			transformation._forward[i][j] = r[i][j];
+			transformation._inverse[i][j] = r[j][i];
+		}
+		transformation._forward[i][3] = inverse ? data[i] : -(r[i][0]*data[0] + r[i][1]*data[1] + r[i][2]*data[2]);
+	}
+	for (int i = 0; i < 3; i++)
+		transformation._inverse[i][3] = -(r[0][i]*transformation._forward[0][3] + r[1][i]*transformation._forward[1][3]
+										+ r[2][i]*transformation._forward[2][3]);
+	return true;
+}
+
+// ==> translation(v)
+// The translation x' = x + v
+//--------------------------------------------------------------------
+Transformation Transformation::translation(const double v[3])
+{
+	Transformation transformation;
+	for (int i = 0; i < 3; i++)
+	{
+		transformation._forward[i][3] = v[i];
+		transformation._inverse[i][3] = -v[i];
+	}
+	return transformation;
+}
+
+// ==> apply(p, q)
+// q = R p + b (q may be p)
+//--------------------------------------------------------------------
+void Transformation::apply(const double p[3], double q[3]) const
+{
+	double x = p[0], y = p[1], z = p[2];
+	for (int i = 0; i < 3; i++)
+		q[i] = _forward[i][0]*x + _forward[i][1]*y + _forward[i][2]*z + _forward[i][3];
+}
+
+// ==> applyInverse(p, q)
+// q = R^T (p - b) (q may be p)
+//--------------------------------------------------------------------
+void Transformation::applyInverse(const double p[3], double q[3]) const
+{
+	double x = p[0], y = p[1], z = p[2];
+	for (int i = 0; i < 3; i++)
+		q[i] = _inverse[i][0]*x + _inverse[i][1]*y + _inverse[i][2]*z + _inverse[i][3];
+}
+
+// ==> rotate(d, e)
+// e = R d (e may be d)
+//--------------------------------------------------------------------
+void Transformation::rotate(const double d[3], double e[3]) const
+{
+	double x = d[0], y = d[1], z = d[2];
+	for (int i = 0; i < 3; i++)
+		e[i] = _forward[i][0]*x + _forward[i][1]*y + _forward[i][2]*z;
+}
+
+// ==> rotateInverse(d, e)
+// e = R^T d (e may be d)
+//--------------------------------------------------------------------
+void Transformation::rotateInverse(const double d[3], double e[3]) const
+{
+	double x = d[0], y = d[1], z = d[2];
+	for (int i = 0; i < 3; i++)
+		e[i] = _inverse[i][0]*x + _inverse[i][1]*y + _inverse[i][2]*z;
+}
+
+// ==> multiply(a, b, c)
+// c = a b for affine 3x4 matrices (the implicit last row is 0 0 0 1)
+//--------------------------------------------------------------------
+static void multiply(const double a[3][4], const double b[3][4], double c[3][4])
+{
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 4; j++)
+			c[i][j] = a[i][0]*b[0][j] + a[i][1]*b[1][j] + a[i][2]*b[2][j];
+		c[i][3] += a[i][3];
+	}
+}
+
+// ==> compose(first)
+// The transformation that applies first and then this one: T(F(p)), with the inverse F^-1(T^-1(p))
+//--------------------------------------------------------------------
+Transformation Transformation::compose(const Transformation& first) const
+{
+	Transformation transformation;
+	multiply(_forward, first._forward, transformation._forward);
+	multiply(first._inverse, _inverse, transformation._inverse);
+	return transformation;
+}
+
+// ==> isIdentity()
+// Returns if the transformation changes nothing
+//--------------------------------------------------------------------
+bool Transformation::isIdentity() const
+{
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 4; j++)
+			if (_forward[i][j] != ((i == j) ? 1.0 : 0.0))
+				return false;
+	return true;
+}
+
+//####################################################################
+//#  TABLE
+//####################################################################
+
+// ==> TransformationTable()
+// Constructor
+//--------------------------------------------------------------------
+TransformationTable::TransformationTable()
+{
+}
+
+// ==> ~TransformationTable()
+// Destructor
+//--------------------------------------------------------------------
+TransformationTable::~TransformationTable()
+{
+}
+
+// ==> addCard(number, data, degrees)
+// Resolve a TR card and add it (replaces a card with the same number), returns false if it is not supported
+//--------------------------------------------------------------------
+bool TransformationTable::addCard(int number, const std::vector<double>& data, bool degrees)
+{
+	Transformation transformation;
+	if (!Transformation::fromCard(data, degrees, transformation))
+		return false;
+	_numbers[number] = add(transformation);
+	return true;
+}
+
+// ==> add(transformation)
+// Add a transformation without number, returns its index
+//--------------------------------------------------------------------
+int TransformationTable::add(const Transformation& transformation)
+{
+	_transformations.push_back(transformation);
+	return _transformations.size() - 1;
+}
+
+// ==> find(number)
+// Returns the index of the TR card (-1 if it is not known)
+//--------------------------------------------------------------------
+int TransformationTable::find(int number) const
+{
+	std::map<int, int>::const_iterator iter = _numbers.find(number);
+	return (iter == _numbers.end()) ? -1 : iter->second;
+}
+
+// ==> clear()
+// Remove all transformations
+//--------------------------------------------------------------------
+void TransformationTable::clear()
+{
+	_transformations.clear();
+	_numbers.clear();
+}
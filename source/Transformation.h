@@ -0,0 +1,68 @@
+//#########################################################################################################
+//## Transformation.h
+//#########################################################################################################
+//##
+//## The transformations of a mcnpx file (TRn and *TRn cards, TRCL and FILL transformations) as affine maps
+//## from the main coordinates to the auxiliary coordinates: x' = R x + b, kept as a 3x4 matrix together
+//## with its inverse. A TR card is resolved once (see Transformation::fromCard), the transformations of
+//## nested universes are composed from these matrices, so a point or ray only pays the multiplications.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef TRANSFORMATION_H
+#define TRANSFORMATION_H
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+struct Transformation
+{
+	public:
+		// the identity
+		Transformation();
+
+		// Resolve the data of a TR card: o1 o2 o3, the cosines (or angles in degrees) of the rotation and m
+		// Returns false if the number of entries is not supported
+		static bool fromCard(const std::vector<double>& data, bool degrees, Transformation& transformation);
+		// The translation x' = x + v
+		static Transformation translation(const double v[3]);
+
+		// x' = R p + b and the inverse
+		void apply(const double p[3], double q[3]) const;
+		void applyInverse(const double p[3], double q[3]) const;
+		// x' = R d (directions and normals, R is orthonormal) and the inverse
+		void rotate(const double d[3], double e[3]) const;
+		void rotateInverse(const double d[3], double e[3]) const;
+		// The transformation that applies first and then this one
+		Transformation compose(const Transformation& first) const;
+		bool isIdentity() const;
+
+		double _forward[3][4];		// R | b
+		double _inverse[3][4];		// R^T | -R^T b
+};
+
+// The TR cards of a geometry by number
+class TransformationTable
+{
+	public:
+		TransformationTable();
+		~TransformationTable();
+
+		// Resolve a TR card and add it (replaces a card with the same number), returns false if it is not supported
+		bool addCard(int number, const std::vector<double>& data, bool degrees);
+		// Add a transformation without number (i.e. the data of a TRCL or FILL between brackets), returns its index
+		int add(const Transformation& transformation);
+		// Returns the index of the TR card (-1 if it is not known)
+		int find(int number) const;
+		const Transformation& get(int index) const { return _transformations[index]; }
+		void clear();
+
+	private:
+		std::vector<Transformation> _transformations;
+		std::map<int, int> _numbers;		// TR number => index in _transformations
+};
+
+#endif
@@ -0,0 +1,98 @@
+//#########################################################################################################
+//## Ui_GeometryErrors.h
+//#########################################################################################################
+//##
+//## Graphical User Interface to list the overlaps and holes that the GeometryChecker found
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef UI_GEOMETRYERRORS_H
+#define UI_GEOMETRYERRORS_H
+
+#include <QMainWindow>
+#include <QtGui>
+#include <QWidget>
+#include <QString>
+#include <QVBoxLayout>
+#include <QTreeWidget>
+#include <QStringList>
+#include <QLabel>
+
+class Ui_GeometryErrors : public QObject
+{
+	Q_OBJECT
+	public:
+		// layout of the ui
+		QVBoxLayout *geometryErrorsFormLayOut;
+		QWidget *geometryErrorsFormLayOutWidget;
+
+		// all errors are added to a tree
+		QTreeWidget* geometryErrorsTree;
+		int indexCounter;
+
+		// number of points that are checked
+		QLabel *summary;
+
+		// ==> addError(type, universe, cells, samples, x, y, z)
+		//  Add an error to the widget, the location is the first point where it was found
+		//--------------------------------------------------------------------
+		void addError(QString type, int universe, QString cells, int samples, double x, double y, double z)
+		{
+			QStringList params;
+			params << type << QString::number(universe) << cells << QString::number(samples)
+					<< QString("%1 %2 %3").arg(x, 0, 'f', 3).arg(y, 0, 'f', 3).arg(z, 0, 'f', 3);
+			QTreeWidgetItem* error = new QTreeWidgetItem((QTreeWidget*)0, params);
+			error->setData(4, Qt::UserRole, x);
+			error->setData(4, Qt::UserRole + 1, y);
+			error->setData(4, Qt::UserRole + 2, z);
+			geometryErrorsTree->insertTopLevelItem(indexCounter, error);
+			indexCounter++;
+		}
+
+		// ==> clearErrors()
+		//   Remove all the errors out of the tree
+		//--------------------------------------------------------------------
+		void clearErrors()
+		{
+			geometryErrorsTree->clear();
+			indexCounter = 0;
+			summary->setText("Use CHECK n on the command line to check n points along the longest side of the geometry");
+		}
+
+		// ==> setupUi(geometryErrors)
+		//   Setup the UI of the widget (with parent geometryErrors)
+		//   Create the basic tree and layout
+		//--------------------------------------------------------------------
+		void setupUi(QWidget *geometryErrors)
+		{
+			indexCounter = 0;
+
+			// Create tree with header
+			geometryErrorsTree = new QTreeWidget();
+			geometryErrorsTree->setColumnCount(5);
+			geometryErrorsTree->setRootIsDecorated(false);
+			QStringList list;
+			list << "Error" << "Universe" << "Cells" << "Points" << "Location";
+			geometryErrorsTree->setHeaderLabels(list);
+
+			summary = new QLabel(geometryErrors);
+			summary->setText("Use CHECK n on the command line to check n points along the longest side of the geometry");
+
+			geometryErrorsFormLayOutWidget = new QWidget(geometryErrors);
+			geometryErrorsFormLayOut = new QVBoxLayout;
+			geometryErrorsFormLayOut->addWidget(geometryErrorsTree);
+			geometryErrorsFormLayOut->addWidget(summary);
+			geometryErrorsFormLayOutWidget->setLayout(geometryErrorsFormLayOut);
+
+			QMetaObject::connectSlotsByName(geometryErrors);
+		} // setupUi
+};
+
+namespace Ui {
+    class GeometryErrors: public Ui_GeometryErrors {};
+} // namespace Ui
+
+
+#endif //
@@ -0,0 +1,400 @@
+//#########################################################################################################
+//## VolumeRenderer.cpp
+//#########################################################################################################
+//##
+//## See-through preview of a VoxelGrid: every ray is marched front to back through the voxels and the color of
+//## the material of every voxel is blended with its alpha, so the inside of the geometry shows through the
+//## materials with a low alpha. The empty and uniform parts of the grid are skipped in one step with an octree
+//## of the lowest and highest material of its nodes. The camera is the one of the RayCaster, the rows of the
+//## image are divided over threads.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "VolumeRenderer.h"
+
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+
+#include <cmath>
+#include <algorithm>
+
+#define PI 3.14159265
+
+#define REFERENCE_LAYERS 100		// the alpha of a material is the opacity of 1/REFERENCE_LAYERS of the longest side of the grid
+#define MIN_TRANSMITTANCE 0.002		// a ray stops when the voxels in front of it let less light through
+#define MAX_PALETTE 32767			// number of drawn materials that fits in the octree
+
+// ==> VolumeRendererTask
+// Renders rows of the image until all rows are taken
+//--------------------------------------------------------------------
+class VolumeRendererTask : public QRunnable
+{
+	public:
+		VolumeRendererTask(VolumeRenderer* renderer) : _renderer(renderer) {}
+		void run() { _renderer->renderRows(); }
+
+	private:
+		VolumeRenderer* _renderer;
+};
+
+// ==> cross(a, b, result)
+//--------------------------------------------------------------------
+static void cross(const double a[3], const double b[3], double result[3])
+{
+	result[0] = a[1]*b[2] - a[2]*b[1];
+	result[1] = a[2]*b[0] - a[0]*b[2];
+	result[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+// ==> normalize(a)
+// Normalize a vector in place, returns its length
+//--------------------------------------------------------------------
+static double normalize(double a[3])
+{
+	double length = std::sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+	if (length > 0.0)
+	{
+		a[0] /= length;
+		a[1] /= length;
+		a[2] /= length;
+	}
+	return length;
+}
+
+// ==> clip(lower, upper, o, inverse, tMin, tMax)
+// Clip tMin and tMax to the part of the ray o + t d in the box, returns false if nothing is left (inverse = 1/d)
+//--------------------------------------------------------------------
+static bool clip(const double lower[3], const double upper[3], const double o[3], const double inverse[3], double& tMin, double& tMax)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		double t0 = (lower[i] - o[i])*inverse[i];
+		double t1 = (upper[i] - o[i])*inverse[i];
+		if (t0 > t1)
+			std::swap(t0, t1);
+		tMin = std::max(tMin, t0);
+		tMax = std::min(tMax, t1);
+	}
+	return tMin < tMax;
+}
+
+// ==> VolumeRenderer(geometry, grid)
+// Constructor
+//--------------------------------------------------------------------
+VolumeRenderer::VolumeRenderer(const Geometry* geometry, const VoxelGrid* grid)
+{
+	_geometry = geometry;
+	_grid = grid;
+	_threads = 0;
+	_skipping = true;
+
+	Camera camera;
+	setCamera(&camera);
+
+	_visibleCells.assign(_geometry->getCellCount(), true);
+	_background = qRgb(107, 139, 170);
+	_reference = 1.0;
+
+	_bits = 0;
+	_bytesPerLine = 0;
+	_width = 0;
+	_height = 0;
+}
+
+// ==> ~VolumeRenderer()
+// Destructor
+//--------------------------------------------------------------------
+VolumeRenderer::~VolumeRenderer()
+{
+}
+
+// ==> setCamera(camera)
+// Look from position + strafe to strafe, with the y axis up (the same view as RayCaster::setCamera)
+//--------------------------------------------------------------------
+void VolumeRenderer::setCamera(const Camera* camera)
+{
+	_position[0] = camera->_camPosX + camera->_camStrafeX;
+	_position[1] = camera->_camPosY + camera->_camStrafeY;
+	_position[2] = camera->_camPosZ + camera->_camStrafeZ;
+
+	_direction[0] = -camera->_camPosX;
+	_direction[1] = -camera->_camPosY;
+	_direction[2] = -camera->_camPosZ;
+	if (normalize(_direction) == 0.0)
+		_direction[2] = 1.0;
+
+	double sky[3] = { 0.0, 1.0, 0.0 };
+	cross(_direction, sky, _right);
+	if (normalize(_right) < 1e-6)
+	{
+		// looking along the y axis
+		double skyZ[3] = { 0.0, 0.0, 1.0 };
+		cross(_direction, skyZ, _right);
+		normalize(_right);
+	}
+	cross(_right, _direction, _up);
+}
+
+// ==> setMaterials(materials)
+// Colors and alphas of the materials, a material with alpha 0 is not drawn (like the textures of the python parser)
+//--------------------------------------------------------------------
+void VolumeRenderer::setMaterials(const std::map<int, Material*>& materials)
+{
+	_materials.clear();
+	std::map<int, Material*>::const_iterator iter;
+	for (iter = materials.begin(); iter != materials.end(); ++iter)
+	{
+		float alpha = iter->second->getAlpha();
+		if (alpha <= 0.0)
+			continue;
+		PaletteEntry entry;
+		entry._color[0] = iter->second->getRed()/255.0;
+		entry._color[1] = iter->second->getGreen()/255.0;
+		entry._color[2] = iter->second->getBlue()/255.0;
+		entry._transparency = 1.0 - std::min(alpha, 1.0f);
+		_materials[iter->first] = entry;
+	}
+}
+
+// ==> setVisibility(cells, universes)
+// Hidden cells and universes are not drawn
+//--------------------------------------------------------------------
+void VolumeRenderer::setVisibility(const std::map<int, Cell*>& cells, const std::map<int, bool>& universes)
+{
+	_visibleCells.assign(_geometry->getCellCount(), true);
+	for (int i = 0; i < _geometry->getCellCount(); i++)
+	{
+		std::map<int, Cell*>::const_iterator iter = cells.find(_geometry->getCell(i)._number);
+		if (iter != cells.end())
+			_visibleCells[i] = iter->second->isVisible();
+	}
+	_universes = universes;
+}
+
+// ==> render(width, height)
+// Render the grid with the camera (horizontal angle of 45 degrees) to an image
+//--------------------------------------------------------------------
+QImage VolumeRenderer::render(int width, int height)
+{
+	QImage image(width, height, QImage::Format_RGB32);
+	image.fill(_background);
+	if (width <= 0 || height <= 0 || _grid->isEmpty())
+		return image;
+
+	buildOctree();
+
+	_bits = image.bits();
+	_bytesPerLine = image.bytesPerLine();
+	_width = width;
+	_height = height;
+	_nextRow = 0;
+
+	int threads = _threads > 0 ? _threads : QThread::idealThreadCount();
+	if (threads < 1)
+		threads = 1;
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+	for (int i = 0; i < threads; i++)
+		pool.start(new VolumeRendererTask(this));
+	pool.waitForDone();
+
+	_bits = 0;
+	return image;
+}
+
+// ==> buildOctree()
+// Give every voxel the palette index of the material of its cell (-1 if it is not drawn) and build the levels of
+// the octree above it: a node of level l covers 2^l x 2^l x 2^l voxels (less at the far sides of the grid) and keeps
+// the lowest and highest index of its children, so a node is empty if the highest is -1 and uniform if they are equal
+//--------------------------------------------------------------------
+void VolumeRenderer::buildOctree()
+{
+	_palette.clear();
+	_levels.clear();
+
+	// palette index of every cell
+	std::map<int, short> indices;
+	std::vector<short> cellIndices(_geometry->getCellCount(), -1);
+	for (int i = 0; i < _geometry->getCellCount(); i++)
+	{
+		const GeometryCell& cell = _geometry->getCell(i);
+		if (!isVisible(cell))
+			continue;
+		std::map<int, PaletteEntry>::const_iterator material = _materials.find(cell._material);
+		if (material == _materials.end())
+			continue;
+		std::map<int, short>::const_iterator index = indices.find(cell._material);
+		if (index == indices.end())
+		{
+			if (_palette.size() >= MAX_PALETTE)
+				continue;
+			index = indices.insert(std::make_pair(cell._material, (short)_palette.size())).first;
+			_palette.push_back(material->second);
+		}
+		cellIndices[i] = index->second;
+	}
+
+	// the voxels
+	OctreeLevel voxels;
+	for (int i = 0; i < 3; i++)
+		voxels._size[i] = _grid->getSize(i);
+	int count = voxels._size[0]*voxels._size[1]*voxels._size[2];
+	voxels._min.resize(count);
+	for (int voxel = 0; voxel < count; voxel++)
+	{
+		int cell = _grid->getCell(voxel);
+		voxels._min[voxel] = (cell != -1) ? cellIndices[cell] : -1;
+	}
+	_levels.push_back(voxels);
+
+	// the levels above until there is one node
+	while (_levels.back()._size[0] > 1 || _levels.back()._size[1] > 1 || _levels.back()._size[2] > 1)
+	{
+		const OctreeLevel& children = _levels.back();
+		const std::vector<short>& childMax = children._max.empty() ? children._min : children._max;
+		OctreeLevel level;
+		for (int i = 0; i < 3; i++)
+			level._size[i] = (children._size[i] + 1)/2;
+		level._min.assign(level._size[0]*level._size[1]*level._size[2], MAX_PALETTE);
+		level._max.assign(level._min.size(), -1);
+
+		int child = 0;
+		for (int k = 0; k < children._size[2]; k++)
+			for (int j = 0; j < children._size[1]; j++)
+				for (int i = 0; i < children._size[0]; i++, child++)
+				{
+					int node = ((k/2)*level._size[1] + j/2)*level._size[0] + i/2;
+					level._min[node] = std::min(level._min[node], children._min[child]);
+					level._max[node] = std::max(level._max[node], childMax[child]);
+				}
+		_levels.push_back(level);
+	}
+
+	double longest = 0.0;
+	for (int i = 0; i < 3; i++)
+		longest = std::max(longest, _grid->getBounds()._max[i] - _grid->getBounds()._min[i]);
+	_reference = longest/REFERENCE_LAYERS;
+}
+
+// ==> renderRows()
+// Render the rows of the image that are not taken yet by another thread
+// The rays are marched in the coordinates of the grid (one unit per voxel) with the distances of the real world
+//--------------------------------------------------------------------
+void VolumeRenderer::renderRows()
+{
+	double tangent = std::tan(22.5*PI/180.0);
+	double aspect = (double)_height/_width;
+
+	const Box& bounds = _grid->getBounds();
+	double voxelSize[3], o[3], lower[3] = { 0.0, 0.0, 0.0 }, upper[3];
+	for (int i = 0; i < 3; i++)
+	{
+		voxelSize[i] = (bounds._max[i] - bounds._min[i])/_grid->getSize(i);
+		o[i] = (_position[i] - bounds._min[i])/voxelSize[i];
+		upper[i] = _grid->getSize(i);
+	}
+	QRgb background = _background;
+	double backgroundColor[3] = { qRed(background)/255.0, qGreen(background)/255.0, qBlue(background)/255.0 };
+
+	int row;
+	while ((row = _nextRow.fetchAndAddRelaxed(1)) < _height)
+	{
+		QRgb* line = (QRgb*)(_bits + row*_bytesPerLine);
+		double v = (1.0 - 2.0*(row + 0.5)/_height)*tangent*aspect;
+		for (int column = 0; column < _width; column++)
+		{
+			double u = (2.0*(column + 0.5)/_width - 1.0)*tangent;
+			double d[3];
+			for (int i = 0; i < 3; i++)
+				d[i] = _direction[i] + u*_right[i] + v*_up[i];
+			normalize(d);
+
+			// direction in the grid, the octant gives the order of the children from front to back
+			double inverse[3];
+			int octant = 0;
+			for (int i = 0; i < 3; i++)
+			{
+				double e = d[i]/voxelSize[i];
+				if (std::fabs(e) < 1e-12)
+					e = (e < 0.0) ? -1e-12 : 1e-12;
+				inverse[i] = 1.0/e;
+				if (e < 0.0)
+					octant |= 1 << i;
+			}
+
+			double tMin = 0.0, tMax = 1e30;
+			if (!clip(lower, upper, o, inverse, tMin, tMax))
+				continue;
+
+			double color[3] = { 0.0, 0.0, 0.0 };
+			double transmittance = 1.0;
+			march(_levels.size() - 1, 0, 0, 0, o, inverse, octant, tMin, tMax, color, transmittance);
+			for (int i = 0; i < 3; i++)
+				color[i] = std::min(255.0, 255.0*(color[i] + transmittance*backgroundColor[i]));
+			line[column] = qRgb((int)color[0], (int)color[1], (int)color[2]);
+		}
+	}
+}
+
+// ==> march(level, i, j, k, o, inverse, octant, tMin, tMax, color, transmittance)
+// Blend the part tMin to tMax of the ray through node (i, j, k) of the level into color, front to back
+// An empty node is skipped and a uniform node (i.e. a voxel) is blended at once: its material lets
+// transparency^(length/reference) of the light through. Without skipping only the voxels are. The children are
+// visited in the order octant ^ n, which is front to back for a ray with the signs of the octant.
+//--------------------------------------------------------------------
+void VolumeRenderer::march(int level, int i, int j, int k, const double o[3], const double inverse[3], int octant,
+					double tMin, double tMax, double color[3], double& transmittance) const
+{
+	const OctreeLevel& node = _levels[level];
+	int index = (k*node._size[1] + j)*node._size[0] + i;
+	short lowest = node._min[index];
+	short highest = (level == 0) ? lowest : node._max[index];
+	bool skip = _skipping || level == 0;
+	if (highest == -1 && skip)
+		return;
+
+	if (lowest == highest && skip)
+	{
+		const PaletteEntry& entry = _palette[highest];
+		double alpha = 1.0 - std::pow(entry._transparency, (tMax - tMin)/_reference);
+		for (int c = 0; c < 3; c++)
+			color[c] += transmittance*alpha*entry._color[c];
+		transmittance *= 1.0 - alpha;
+		return;
+	}
+
+	const OctreeLevel& children = _levels[level - 1];
+	int span = 1 << (level - 1);
+	for (int n = 0; n < 8 && transmittance >= MIN_TRANSMITTANCE; n++)
+	{
+		int child = n ^ octant;
+		int index[3] = { 2*i + (child & 1), 2*j + ((child >> 1) & 1), 2*k + ((child >> 2) & 1) };
+		if (index[0] >= children._size[0] || index[1] >= children._size[1] || index[2] >= children._size[2])
+			continue;
+
+		double lower[3], upper[3];
+		for (int a = 0; a < 3; a++)
+		{
+			lower[a] = index[a]*span;
+			upper[a] = std::min((index[a] + 1)*span, _grid->getSize(a));
+		}
+		double t0 = tMin, t1 = tMax;
+		if (clip(lower, upper, o, inverse, t0, t1))
+			march(level - 1, index[0], index[1], index[2], o, inverse, octant, t0, t1, color, transmittance);
+	}
+}
+
+// ==> isVisible(cell)
+// Returns if the voxels of the cell are drawn: not in the outside world (imp:n=0), the cell and its universe not hidden
+//--------------------------------------------------------------------
+bool VolumeRenderer::isVisible(const GeometryCell& cell) const
+{
+	if (cell._imp0 || !_visibleCells[&cell - &_geometry->getCell(0)])
+		return false;
+	std::map<int, bool>::const_iterator universe = _universes.find(cell._universe);
+	return universe == _universes.end() || universe->second;
+}
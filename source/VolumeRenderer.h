@@ -0,0 +1,108 @@
+//#########################################################################################################
+//## VolumeRenderer.h
+//#########################################################################################################
+//##
+//## See-through preview of a VoxelGrid: every ray is marched front to back through the voxels and the color of
+//## the material of every voxel is blended with its alpha, so the inside of the geometry shows through the
+//## materials with a low alpha. The empty and uniform parts of the grid are skipped in one step with an octree
+//## of the lowest and highest material of its nodes. The camera is the one of the RayCaster, the rows of the
+//## image are divided over threads.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef VOLUME_RENDERER_H
+#define VOLUME_RENDERER_H
+
+#include <QImage>
+#include <QColor>
+#include <QAtomicInt>
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+#include "Geometry.h"
+#include "VoxelGrid.h"
+#include "Camera.h"
+#include "Material.h"
+#include "Cell.h"
+
+class VolumeRenderer
+{
+	public:
+		VolumeRenderer(const Geometry* geometry, const VoxelGrid* grid);
+		~VolumeRenderer();
+
+		// Camera of the POV-Ray scene (see RayCaster::setCamera)
+		void setCamera(const Camera* camera);
+		// Colors and alphas of the materials, alpha is the opacity of a layer of 1/REFERENCE_LAYERS of the grid
+		// (1 is opaque, a material without color or with alpha 0 is not drawn)
+		void setMaterials(const std::map<int, Material*>& materials);
+		// Hidden cells and universes are not drawn (only the deepest cell of a voxel is known, see VoxelGrid)
+		void setVisibility(const std::map<int, Cell*>& cells, const std::map<int, bool>& universes);
+		void setBackgroundColor(QColor color) { _background = color.rgb(); }
+		// Number of threads (0 = number of cores)
+		void setThreads(int threads) { _threads = threads; }
+		// Skip the empty and uniform nodes of the octree in one step (the default), else every voxel is marched
+		void setSkipping(bool skipping) { _skipping = skipping; }
+
+		// Render the grid to an image
+		QImage render(int width, int height);
+
+		// Render the rows of the image that are not taken yet (called by every thread)
+		void renderRows();
+
+	private:
+		// color and transparency (1 - alpha) of a material that is drawn
+		struct PaletteEntry
+		{
+			double _color[3];
+			double _transparency;
+		};
+
+		// level of the octree: the lowest and highest palette index (-1 = nothing drawn) of blocks of 2^level voxels
+		struct OctreeLevel
+		{
+			int _size[3];
+			std::vector<short> _min;
+			std::vector<short> _max;		// empty for level 0 (a voxel is uniform)
+		};
+
+		void buildOctree();
+		void march(int level, int i, int j, int k, const double o[3], const double inverse[3], int octant,
+					double tMin, double tMax, double color[3], double& transmittance) const;
+		bool isVisible(const GeometryCell& cell) const;
+
+		const Geometry* _geometry;
+		const VoxelGrid* _grid;
+		int _threads;
+		bool _skipping;
+
+		// camera
+		double _position[3];
+		double _direction[3];
+		double _right[3];
+		double _up[3];
+
+		// materials and visibility
+		std::map<int, PaletteEntry> _materials;
+		std::vector<bool> _visibleCells;		// per cell index
+		std::map<int, bool> _universes;
+		QRgb _background;
+
+		// grid
+		std::vector<PaletteEntry> _palette;
+		std::vector<OctreeLevel> _levels;
+		double _reference;					// thickness of the layer of the alpha of a material
+
+		// image that is rendered
+		uchar* _bits;
+		int _bytesPerLine;
+		int _width;
+		int _height;
+		QAtomicInt _nextRow;
+};
+
+#endif
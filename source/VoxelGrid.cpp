@@ -0,0 +1,235 @@
+//#########################################################################################################
+//## VoxelGrid.cpp
+//#########################################################################################################
+//##
+//## The Geometry sampled on a regular 3D grid: the deepest cell (see Geometry::locate), its material and the label
+//## of its path (for the outlines of the SlicePlotter) at the center of every voxel. The slabs of the grid (one z index each) are divided over threads. A grid is
+//## saved compressed in the temp folder with a key of the geometry file and the grid, so the same grid of
+//## the same file is loaded instead of sampled again. Slices through the grid are lookups (see SlicePlotter).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include "VoxelGrid.h"
+
+#include <QFile>
+#include <QByteArray>
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#define MAX_VOXELS 67108864				// voxels of the largest grid (three ints per voxel: 768 MB)
+#define CACHE_HEADER "MCNPX VOXELS 2\n"	// first line of a cache file, the key is the second line
+
+// ==> VoxelGridTask
+// Samples slabs of the grid until all slabs are taken
+//--------------------------------------------------------------------
+class VoxelGridTask : public QRunnable
+{
+	public:
+		VoxelGridTask(VoxelGrid* grid) : _grid(grid) {}
+		void run() { _grid->buildSlabs(); }
+
+	private:
+		VoxelGrid* _grid;
+};
+
+// ==> VoxelGrid()
+// Constructor
+//--------------------------------------------------------------------
+VoxelGrid::VoxelGrid()
+{
+	_geometry = 0;
+	clear();
+}
+
+// ==> ~VoxelGrid()
+// Destructor
+//--------------------------------------------------------------------
+VoxelGrid::~VoxelGrid()
+{
+}
+
+// ==> getSize(bounds, resolution, size)
+// Number of voxels along every axis for cubic voxels with resolution voxels along the longest axis of the bounds
+//--------------------------------------------------------------------
+void VoxelGrid::getSize(const Box& bounds, int resolution, int size[3])
+{
+	double longest = 0.0;
+	for (int i = 0; i < 3; i++)
+		longest = std::max(longest, bounds._max[i] - bounds._min[i]);
+	for (int i = 0; i < 3; i++)
+		size[i] = (longest > 0.0) ? std::max(1, (int)std::ceil(resolution*(bounds._max[i] - bounds._min[i])/longest - 1e-9)) : 1;
+}
+
+// ==> getKey(geometry, bounds, size)
+// Key of the grid of a geometry in the cache: the hash of the geometry file, the bounds and the size
+//--------------------------------------------------------------------
+QString VoxelGrid::getKey(const Geometry* geometry, const Box& bounds, const int size[3])
+{
+	QString key = geometry->getHash();
+	for (int i = 0; i < 3; i++)
+		key += "&" + QString::number(size[i]) + " " + QString::number(bounds._min[i], 'g', 17) + " " + QString::number(bounds._max[i], 'g', 17);
+	return key;
+}
+
+// ==> build(geometry, bounds, size, threads)
+// Sample the geometry at the centers of the voxels of the bounds with the threads (0 = number of cores)
+// Returns false if the bounds are not finite or the grid has more than MAX_VOXELS voxels
+//--------------------------------------------------------------------
+bool VoxelGrid::build(const Geometry* geometry, const Box& bounds, const int size[3], int threads)
+{
+	clear();
+	double voxels = (double)size[0]*size[1]*size[2];
+	if (!bounds.isFinite() || bounds.isEmpty() || size[0] < 1 || size[1] < 1 || size[2] < 1 || voxels > MAX_VOXELS)
+	{
+		std::cout << "ERROR (VoxelGrid::build) => can't sample a grid of " << size[0] << " x " << size[1] << " x " << size[2] << " voxels" << std::endl;
+		return false;
+	}
+
+	_bounds = bounds;
+	for (int i = 0; i < 3; i++)
+	{
+		_size[i] = size[i];
+		_voxelSize[i] = (bounds._max[i] - bounds._min[i])/size[i];
+	}
+	_cells.assign(size[0]*size[1]*size[2], -1);
+	_materials.assign(_cells.size(), 0);
+	_labels.assign(_cells.size(), -1);
+
+	_geometry = geometry;
+	_nextSlab = 0;
+	if (threads <= 0)
+		threads = QThread::idealThreadCount();
+	if (threads < 1)
+		threads = 1;
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+	for (int i = 0; i < threads; i++)
+		pool.start(new VoxelGridTask(this));
+	pool.waitForDone();
+	_geometry = 0;
+	return true;
+}
+
+// ==> buildSlabs()
+// Sample the slabs (z index) that are not taken yet by another thread, the centers of a slab are located together
+//--------------------------------------------------------------------
+void VoxelGrid::buildSlabs()
+{
+	int count = _size[0]*_size[1];
+	std::vector<double> x(count), y(count), z(count);
+	SenseBuffers buffers;
+	int k;
+	while ((k = _nextSlab.fetchAndAddRelaxed(1)) < _size[2])
+	{
+		for (int j = 0, n = 0; j < _size[1]; j++)
+			for (int i = 0; i < _size[0]; i++, n++)
+			{
+				x[n] = _bounds._min[0] + (i + 0.5)*_voxelSize[0];
+				y[n] = _bounds._min[1] + (j + 0.5)*_voxelSize[1];
+				z[n] = _bounds._min[2] + (k + 0.5)*_voxelSize[2];
+			}
+
+		int* cells = &_cells[k*count];
+		_geometry->locate(&x[0], &y[0], &z[0], count, cells, buffers, &_labels[k*count]);
+		for (int n = 0; n < count; n++)
+			_materials[k*count + n] = (cells[n] != -1) ? _geometry->getCell(cells[n])._material : 0;
+	}
+}
+
+// ==> save(fileName, key)
+// Write the grid to a cache file: the header, the key and the compressed size, bounds, cells, materials and labels
+//--------------------------------------------------------------------
+bool VoxelGrid::save(QString fileName, QString key) const
+{
+	if (isEmpty())
+		return false;
+	QFile file(fileName);
+	if (!file.open(QIODevice::WriteOnly))
+	{
+		std::cout << "ERROR (VoxelGrid::save) => couldn't write voxel cache " << fileName.toStdString() << std::endl;
+		return false;
+	}
+
+	QByteArray data;
+	data.append((const char*)_size, sizeof(_size));
+	data.append((const char*)_bounds._min, sizeof(_bounds._min));
+	data.append((const char*)_bounds._max, sizeof(_bounds._max));
+	data.append((const char*)&_cells[0], _cells.size()*sizeof(int));
+	data.append((const char*)&_materials[0], _materials.size()*sizeof(int));
+	data.append((const char*)&_labels[0], _labels.size()*sizeof(int));
+
+	file.write(QByteArray(CACHE_HEADER) + key.toUtf8() + "\n");
+	file.write(qCompress(data));
+	file.close();
+	return true;
+}
+
+// ==> load(fileName, key)
+// Load the grid from a cache file, returns false if there is none, it has another key or it is damaged
+//--------------------------------------------------------------------
+bool VoxelGrid::load(QString fileName, QString key)
+{
+	clear();
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly))
+		return false;
+	QByteArray contents = file.readAll();
+	file.close();
+
+	QByteArray header = QByteArray(CACHE_HEADER) + key.toUtf8() + "\n";
+	if (!contents.startsWith(header))
+		return false;
+	QByteArray data = qUncompress(contents.mid(header.size()));
+
+	int size[3];
+	int offset = sizeof(size) + 2*sizeof(_bounds._min);
+	if (data.size() < offset)
+		return false;
+	memcpy(size, data.constData(), sizeof(size));
+	int voxels = size[0]*size[1]*size[2];
+	if (size[0] < 1 || size[1] < 1 || size[2] < 1 || (double)size[0]*size[1]*size[2] > MAX_VOXELS
+		|| data.size() != offset + 3*voxels*(int)sizeof(int))
+	{
+		std::cout << "ERROR (VoxelGrid::load) => damaged voxel cache " << fileName.toStdString() << std::endl;
+		return false;
+	}
+
+	memcpy(_bounds._min, data.constData() + sizeof(size), sizeof(_bounds._min));
+	memcpy(_bounds._max, data.constData() + sizeof(size) + sizeof(_bounds._min), sizeof(_bounds._max));
+	for (int i = 0; i < 3; i++)
+	{
+		_size[i] = size[i];
+		_voxelSize[i] = (_bounds._max[i] - _bounds._min[i])/size[i];
+	}
+	_cells.resize(voxels);
+	_materials.resize(voxels);
+	_labels.resize(voxels);
+	memcpy(&_cells[0], data.constData() + offset, voxels*sizeof(int));
+	memcpy(&_materials[0], data.constData() + offset + voxels*sizeof(int), voxels*sizeof(int));
+	memcpy(&_labels[0], data.constData() + offset + 2*voxels*sizeof(int), voxels*sizeof(int));
+	return true;
+}
+
+// ==> clear()
+// Remove the grid
+//--------------------------------------------------------------------
+void VoxelGrid::clear()
+{
+	_bounds = Box();
+	for (int i = 0; i < 3; i++)
+	{
+		_size[i] = 0;
+		_voxelSize[i] = 1.0;
+	}
+	_cells.clear();
+	_materials.clear();
+	_labels.clear();
+}
@@ -0,0 +1,82 @@
+//#########################################################################################################
+//## VoxelGrid.h
+//#########################################################################################################
+//##
+//## The Geometry sampled on a regular 3D grid: the deepest cell (see Geometry::locate), its material and the label
+//## of its path (for the outlines of the SlicePlotter) at the center of every voxel. The slabs of the grid (one z index each) are divided over threads. A grid is
+//## saved compressed in the temp folder with a key of the geometry file and the grid, so the same grid of
+//## the same file is loaded instead of sampled again. Slices through the grid are lookups (see SlicePlotter).
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#ifndef VOXEL_GRID_H
+#define VOXEL_GRID_H
+
+#include <QString>
+#include <QAtomicInt>
+
+#include <iostream>
+#include <vector>
+
+#include "Geometry.h"
+
+class VoxelGrid
+{
+	public:
+		VoxelGrid();
+		~VoxelGrid();
+
+		// Number of voxels along every axis for cubic voxels with resolution voxels along the longest axis of the bounds
+		static void getSize(const Box& bounds, int resolution, int size[3]);
+		// Key of the grid of a geometry in the cache: the hash of the geometry file, the bounds and the size
+		static QString getKey(const Geometry* geometry, const Box& bounds, const int size[3]);
+
+		// Sample the geometry at the centers of the voxels of the bounds, returns false if the grid is too large
+		bool build(const Geometry* geometry, const Box& bounds, const int size[3], int threads = 0);
+		// Load the grid from a cache file, returns false if there is none or it has another key
+		bool load(QString fileName, QString key);
+		bool save(QString fileName, QString key) const;
+		void clear();
+		bool isEmpty() const { return _cells.empty(); }
+
+		const Box& getBounds() const { return _bounds; }
+		int getSize(int axis) const { return _size[axis]; }
+		// Index of the voxel that contains the point, returns false if the point is outside the grid
+		bool findVoxel(const double p[3], int& voxel) const
+		{
+			int index[3];
+			for (int i = 0; i < 3; i++)
+			{
+				double x = (p[i] - _bounds._min[i])/_voxelSize[i];
+				if (!(x >= 0.0 && x < _size[i]))
+					return false;
+				index[i] = (int)x;
+			}
+			voxel = (index[2]*_size[1] + index[1])*_size[0] + index[0];
+			return true;
+		}
+		// Cell index (-1 if there is none) and material of a voxel
+		int getCell(int voxel) const { return _cells[voxel]; }
+		int getMaterial(int voxel) const { return _materials[voxel]; }
+		// Label of the cells and lattice elements above the cell of a voxel (see Geometry::locate)
+		int getLabel(int voxel) const { return _labels[voxel]; }
+
+		// Sample the slabs that are not taken yet (called by every thread)
+		void buildSlabs();
+
+	private:
+		Box _bounds;
+		int _size[3];
+		double _voxelSize[3];
+		std::vector<int> _cells;
+		std::vector<int> _materials;
+		std::vector<int> _labels;
+
+		// build
+		const Geometry* _geometry;
+		QAtomicInt _nextSlab;
+};
+
+#endif
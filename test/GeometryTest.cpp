@@ -0,0 +1,889 @@
+//#########################################################################################################
+//## GeometryTest.cpp
+//#########################################################################################################
+//##
+//## Checks the native Geometry on small geometry files (see Geometry::load): the cell that is found for a point
+//## through the filled cells and lattice elements, with TRCL and FILL transformations, one by one and many points
+//## at once, and the labels of the outlines of the lattice elements. The surfaces are placed by TR cards with all
+//## cosines, with the angles in degrees (*TR) and with a partial matrix. The vector kernels of the SurfaceStore must
+//## give the values of the scalar kernels for every kind of quadric, a torus is evaluated by the scalar kernels.
+//## The bounding volume hierarchies must find the boxes and cells that a search of all of them finds. The compiled
+//## code of the cells must give the result of their node trees. A voxel grid is loaded from its cache file as it
+//## was saved, and not for another geometry file, size or bounds. The volume renderer skips the empty and uniform
+//## nodes of its octree without changing the image. The geometry checker finds the overlaps and holes of a
+//## geometry, also in a filled universe, and none in a valid geometry.
+//## Prints every check that fails and returns the number of failures.
+//##
+//## Part of MCNPX Visualiser
+//## (c) Nick Michiels for SCK-CEN Mol (2011)
+//#########################################################################################################
+
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+
+#include "Geometry.h"
+#include "VoxelGrid.h"
+#include "VolumeRenderer.h"
+#include "GeometryChecker.h"
+
+// A cell moved by a TRCL and filled with a universe, next to a lattice of which the lattice cell is moved by a TRCL
+//		cell 1: sphere of radius 5 moved to x = 20, filled with universe 1 (cell 11 inside a sphere of radius 1)
+//		cell 51: square lattice of pitch 2 moved by x = 0.5, the elements are universe 6 (cell 60) for an even i and
+//				 universe 7 (cell 70) for an odd i, both a cylinder of radius 0.3 around the center of the element
+static const char* TRCL_GEOMETRY =
+	"SURFACE&1&0&SO&1.0\n"
+	"SURFACE&10&0&SO&5.0\n"
+	"SURFACE&20&0&PX&1.0\n"
+	"SURFACE&21&0&PX&-1.0\n"
+	"SURFACE&22&0&PY&1.0\n"
+	"SURFACE&23&0&PY&-1.0\n"
+	"SURFACE&31&0&CZ&0.3\n"
+	"SURFACE&60&0&RPP&-7.0 7.0 -7.0 7.0 -1.0 1.0\n"
+	"SURFACE&100&0&SO&50.0\n"
+	"CELL&1&0&0&1&0&0&-10\n"
+	"TRCL&1&0&0&20.0 0.0 0.0\n"
+	"CELL&2&0&0&0&0&0&#1 60 -100\n"
+	"CELL&3&0&0&0&0&1&100\n"
+	"CELL&11&1&1&0&0&0&-1\n"
+	"CELL&12&2&1&0&0&0&1\n"
+	"CELL&50&0&0&5&0&0&-60\n"
+	"CELL&51&0&5&0&1&0&-20 21 -22 23\n"
+	"LATTICE&51&-3 3 -3 3 0 0&-1.0 -1.0 inf 1.0 1.0 inf&"
+		"7 6 7 6 7 6 7 7 6 7 6 7 6 7 7 6 7 6 7 6 7 7 6 7 6 7 6 7 7 6 7 6 7 6 7 7 6 7 6 7 6 7 7 6 7 6 7 6 7\n"
+	"TRCL&51&0&0&0.5 0.0 0.0\n"
+	"CELL&60&6&6&0&0&0&-31\n"
+	"CELL&61&8&6&0&0&0&31\n"
+	"CELL&70&7&7&0&0&0&-31\n"
+	"CELL&71&8&7&0&0&0&31\n";
+
+// Boxes and a cylinder placed by the different forms of a TR card (the surfaces are given in auxiliary coordinates)
+//		cell 1: box 0 4 x -1 1 x -1 1 by TR1, all 9 cosines: x' along y and y' along -x, moved to x = 10
+//		cell 2: box 0 4 x -0.5 0.5 x -1 1 by *TR2, the angles in degrees of x' and y' rotated 30 around z, moved to y = 20
+//		cell 3: box 0 4 x -1 1 x 0 0.5 by TR3, only x' along z and y' along x (z' = x' cross y' is along y), moved to y = -20
+//		cell 4: cylinder of radius 0.5 around x' by TR4, only x' (not normalized) along x = y, moved to z = 20
+static const char* TR_GEOMETRY =
+	"TR&1&10.0 0.0 0.0 0.0 1.0 0.0 -1.0 0.0 0.0 0.0 0.0 1.0\n"
+	"*TR&2&0.0 20.0 0.0 30.0 60.0 90.0 120.0 30.0 90.0 90.0 90.0 0.0\n"
+	"TR&3&0.0 -20.0 0.0 0.0 0.0 1.0 1.0 0.0 0.0\n"
+	"TR&4&0.0 0.0 20.0 1.0 1.0 0.0\n"
+	"SURFACE&1&1&RPP&0.0 4.0 -1.0 1.0 -1.0 1.0\n"
+	"SURFACE&2&2&RPP&0.0 4.0 -0.5 0.5 -1.0 1.0\n"
+	"SURFACE&3&3&RPP&0.0 4.0 -1.0 1.0 0.0 0.5\n"
+	"SURFACE&4&4&CX&0.5\n"
+	"SURFACE&100&0&SO&50.0\n"
+	"CELL&1&1&0&0&0&0&-1\n"
+	"CELL&2&2&0&0&0&0&-2\n"
+	"CELL&3&3&0&0&0&0&-3\n"
+	"CELL&4&4&0&0&0&0&-4 -100\n"
+	"CELL&5&0&0&0&0&0&1 2 3 4 -100\n"
+	"CELL&6&0&0&0&0&1&100\n";
+
+static int failures = 0;
+
+// ==> loadGeometry(geometry, text)
+// Write the text to a geometry file and load it
+//--------------------------------------------------------------------
+static bool loadGeometry(Geometry& geometry, const char* text)
+{
+	QString fileName = QDir::tempPath() + "/GeometryTest.geom";
+	QFile file(fileName);
+	if (!file.open(QFile::WriteOnly | QFile::Text))
+		return false;
+	QTextStream out(&file);
+	out << text;
+	file.close();
+	bool loaded = geometry.load(fileName);
+	QFile::remove(fileName);
+	return loaded;
+}
+
+// ==> checkLocate(geometry, x, y, z, number)
+// The deepest cell at the point of the real world must be the cell with the number (0 for no cell)
+//--------------------------------------------------------------------
+static void checkLocate(const Geometry& geometry, double x, double y, double z, int number)
+{
+	double p[3] = { x, y, z };
+	int cell = geometry.locate(p);
+	int found = (cell != -1) ? geometry.getCell(cell)._number : 0;
+	if (found != number)
+	{
+		std::cout << "FAILED (locate) => " << x << " " << y << " " << z << " is in cell " << found << ", expected " << number << std::endl;
+		failures++;
+	}
+}
+
+// ==> testTrcl()
+// The filling and the lattice elements move with the TRCL of their cell
+//--------------------------------------------------------------------
+static void testTrcl()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, TRCL_GEOMETRY))
+	{
+		std::cout << "FAILED (testTrcl) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+
+	// filled cell
+	checkLocate(geometry, 20.0, 0.0, 0.0, 11);
+	checkLocate(geometry, 20.5, 0.5, 0.0, 11);
+	checkLocate(geometry, 22.0, 0.0, 0.0, 12);
+	checkLocate(geometry, 19.0, 2.0, 3.0, 12);
+	checkLocate(geometry, 10.0, 0.0, 0.0, 2);
+
+	// lattice
+	checkLocate(geometry, 0.5, 0.0, 0.0, 60);
+	checkLocate(geometry, 0.0, 0.0, 0.0, 61);
+	checkLocate(geometry, 2.5, 0.1, 0.0, 70);
+	checkLocate(geometry, 2.0, 0.0, 0.0, 71);
+	checkLocate(geometry, -1.5, -2.0, 0.5, 70);
+	checkLocate(geometry, 4.5, 4.0, 0.0, 60);
+}
+
+// ==> testTrCards()
+// The surfaces are placed by a TR card with all cosines, with the angles in degrees (*TR) and with a partial matrix
+//--------------------------------------------------------------------
+static void testTrCards()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, TR_GEOMETRY))
+	{
+		std::cout << "FAILED (testTrCards) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+
+	// cosines
+	checkLocate(geometry, 10.0, 2.0, 0.0, 1);
+	checkLocate(geometry, 10.5, 3.5, 0.5, 1);
+	checkLocate(geometry, 12.0, 0.0, 0.0, 5);
+	checkLocate(geometry, 10.0, -0.5, 0.0, 5);
+
+	// degrees
+	checkLocate(geometry, 2.598, 21.5, 0.0, 2);
+	checkLocate(geometry, 1.0, 20.6, 0.0, 2);
+	checkLocate(geometry, 3.0, 20.0, 0.0, 5);
+	checkLocate(geometry, 1.5, 22.6, 0.0, 5);
+
+	// x' and y', z' from their cross product
+	checkLocate(geometry, 0.0, -19.7, 3.0, 3);
+	checkLocate(geometry, 0.5, -19.9, 0.5, 3);
+	checkLocate(geometry, 0.0, -20.3, 3.0, 5);
+	checkLocate(geometry, 0.0, -19.7, -1.0, 5);
+
+	// only x'
+	checkLocate(geometry, 3.0, 3.0, 20.0, 4);
+	checkLocate(geometry, -5.0, -5.2, 20.3, 4);
+	checkLocate(geometry, 3.0, 3.0, 20.4, 4);
+	checkLocate(geometry, 3.0, 2.0, 20.0, 5);
+	checkLocate(geometry, 3.0, 3.0, 20.6, 5);
+}
+
+// ==> testBatch()
+// Locating a grid of points at once (with the vector kernels) finds the same cells as locating them one by one
+//--------------------------------------------------------------------
+static void testBatch()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, TRCL_GEOMETRY))
+	{
+		std::cout << "FAILED (testBatch) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+
+	const int size = 200;
+	std::vector<double> x(size*size), y(size*size), z(size*size);
+	for (int j = 0; j < size; j++)
+		for (int i = 0; i < size; i++)
+		{
+			x[j*size + i] = -10.0 + 40.0*(i + 0.5)/size;
+			y[j*size + i] = -10.0 + 20.0*(j + 0.5)/size;
+			z[j*size + i] = 0.25;
+		}
+	std::vector<int> cells(size*size);
+	SenseBuffers buffers;
+	geometry.locate(&x[0], &y[0], &z[0], size*size, &cells[0], buffers);
+	for (int i = 0; i < size*size; i++)
+	{
+		double p[3] = { x[i], y[i], z[i] };
+		if (geometry.locate(p) != cells[i])
+		{
+			std::cout << "FAILED (testBatch) => " << p[0] << " " << p[1] << " " << p[2] << " is in another cell than one by one" << std::endl;
+			failures++;
+			return;
+		}
+	}
+}
+
+// ==> testLabels()
+// The same cell in two elements of a lattice has two labels, in the same element it has one
+//--------------------------------------------------------------------
+static void testLabels()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, TRCL_GEOMETRY))
+	{
+		std::cout << "FAILED (testLabels) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+
+	// cell 61 in the element of x = 0.5 (twice) and of x = 4.5, cell 2 outside the lattice
+	double x[4] = { 0.0, 0.0, 4.0, 10.0 };
+	double y[4] = { 0.5, -0.5, 0.5, 0.0 };
+	double z[4] = { 0.0, 0.0, 0.0, 0.0 };
+	int cells[4], labels[4];
+	SenseBuffers buffers;
+	geometry.locate(x, y, z, 4, cells, buffers, labels);
+	if (labels[0] != labels[1])
+	{
+		std::cout << "FAILED (testLabels) => one lattice element has two labels" << std::endl;
+		failures++;
+	}
+	if (cells[0] != cells[2] || labels[0] == labels[2])
+	{
+		std::cout << "FAILED (testLabels) => two lattice elements have the same label" << std::endl;
+		failures++;
+	}
+	if (labels[3] != cells[3])
+	{
+		std::cout << "FAILED (testLabels) => the label of a cell that isn't filled is not the cell" << std::endl;
+		failures++;
+	}
+}
+
+// ==> testKernels()
+// The vector kernels give the values and senses of the scalar kernels for a plane, a quadric without cross terms
+// and a general quadric, for a number of points that isn't a multiple of the vector width
+//--------------------------------------------------------------------
+static void testKernels()
+{
+	SurfaceStore store;
+	double axis[3] = { 1.0, 2.0, 2.0 };
+	double m[3][3], l[3] = { 0.5, -1.0, 0.0 };
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			m[i][j] = (i == j ? 1.0 : 0.0) - axis[i]*axis[j]/9.0;
+	Quadric sphere;
+	sphere._c[0] = sphere._c[1] = sphere._c[2] = 1.0;
+	sphere._c[6] = -2.0;
+	sphere._c[9] = -20.0;
+	store.add(Quadric::plane(1.0, -2.0, 0.5, 1.5));
+	store.add(sphere);
+	store.add(Quadric::fromMatrix(m, l, -9.0));
+	SurfaceStore::Kind kinds[3] = { SurfaceStore::PLANE, SurfaceStore::DIAGONAL, SurfaceStore::GENERAL };
+
+	const int count = 1001;
+	std::vector<double> x(count), y(count), z(count);
+	for (int i = 0; i < count; i++)
+	{
+		x[i] = -8.0 + 16.0*((i*37) % count)/count;
+		y[i] = -8.0 + 16.0*((i*101) % count)/count;
+		z[i] = -8.0 + 16.0*((i*211) % count)/count;
+	}
+	std::vector<double> values(count), scalarValues(count);
+	std::vector<unsigned char> senses(count), scalarSenses(count);
+	for (int n = 0; n < 3; n++)
+	{
+		if (store.getKind(n) != kinds[n])
+		{
+			std::cout << "FAILED (testKernels) => quadric " << n << " is stored as kind " << store.getKind(n) << ", expected " << kinds[n] << std::endl;
+			failures++;
+		}
+		store.evaluatePoints(n, &x[0], &y[0], &z[0], count, &values[0]);
+		store.evaluatePointsScalar(n, &x[0], &y[0], &z[0], count, &scalarValues[0]);
+		store.sensePoints(n, &x[0], &y[0], &z[0], count, &senses[0]);
+		store.sensePointsScalar(n, &x[0], &y[0], &z[0], count, &scalarSenses[0]);
+		for (int i = 0; i < count; i++)
+		{
+			double p[3] = { x[i], y[i], z[i] };
+			if (values[i] != scalarValues[i] || senses[i] != scalarSenses[i] || senses[i] != (store.evaluate(n, p) < 0.0))
+			{
+				std::cout << "FAILED (testKernels) => quadric of kind " << kinds[n] << " in " << p[0] << " " << p[1] << " " << p[2] << ": "
+					<< values[i] << " with " << SurfaceStore::getInstructionSet().toStdString() << ", " << scalarValues[i] << " scalar" << std::endl;
+				failures++;
+				break;
+			}
+		}
+	}
+
+	// one point against the three kinds, repeated past the vector width
+	for (int i = 0; i < 4; i++)
+	{
+		store.add(Quadric::plane(1.0, -2.0, 0.5, 1.5 + i));
+		store.add(sphere);
+		store.add(Quadric::fromMatrix(m, l, -9.0 - i));
+	}
+	int quadrics = store.getCount();
+	for (int i = 0; i < count; i += 7)
+	{
+		double p[3] = { x[i], y[i], z[i] };
+		store.evaluateQuadrics(p, 0, quadrics, &values[0]);
+		store.evaluateQuadricsScalar(p, 0, quadrics, &scalarValues[0]);
+		store.senseQuadrics(p, 0, quadrics, &senses[0]);
+		store.senseQuadricsScalar(p, 0, quadrics, &scalarSenses[0]);
+		for (int n = 0; n < quadrics; n++)
+			if (values[n] != scalarValues[n] || senses[n] != scalarSenses[n])
+			{
+				std::cout << "FAILED (testKernels) => quadric " << n << " of many in " << p[0] << " " << p[1] << " " << p[2] << ": "
+					<< values[n] << " with " << SurfaceStore::getInstructionSet().toStdString() << ", " << scalarValues[n] << " scalar" << std::endl;
+				failures++;
+				return;
+			}
+	}
+}
+
+// ==> testTorus()
+// A torus is stored as a torus and evaluated by the scalar kernels, also among quadrics in the kernels of many
+// quadrics (the vector kernels would take its parameters for coefficients)
+//--------------------------------------------------------------------
+static void testTorus()
+{
+	// TZ 1 2 3 6 2 1: radius 6, semi-axis 2 along z and 1 in the plane
+	SurfaceStore store;
+	double center[3] = { 1.0, 2.0, 3.0 };
+	store.add(Quadric::plane(0.0, 0.0, 1.0, 0.0));
+	int torus = store.addTorus(center, 2, 6.0, 2.0, 1.0);
+	for (int i = 0; i < 3; i++)
+		store.add(Quadric::plane(1.0, 0.0, 0.0, i));
+	if (store.getKind(torus) != SurfaceStore::TORUS)
+	{
+		std::cout << "FAILED (testTorus) => the torus is stored as kind " << store.getKind(torus) << std::endl;
+		failures++;
+		return;
+	}
+
+	// in the tube, in the hole, above the tube, in the tube on the other side and outside of it (twice, past the vector width)
+	double x[10] = { 7.0, 1.0, 7.0, 1.0, 1.0, 7.5, 1.0, 7.0, 1.0, 8.5 };
+	double y[10] = { 2.0, 2.0, 2.0, -4.0, 9.5, 2.0, 2.0, 2.0, -3.5, 2.0 };
+	double z[10] = { 3.0, 3.0, 5.5, 4.5, 3.0, 4.0, 3.0, 5.5, 3.0, 3.0 };
+	unsigned char expected[10] = { 1, 0, 0, 1, 0, 1, 0, 0, 1, 0 };
+	unsigned char senses[10], scalarSenses[10];
+	store.sensePoints(torus, x, y, z, 10, senses);
+	store.sensePointsScalar(torus, x, y, z, 10, scalarSenses);
+	for (int i = 0; i < 10; i++)
+	{
+		double p[3] = { x[i], y[i], z[i] };
+		bool inside = store.evaluate(torus, p) < 0.0;
+		if (senses[i] != expected[i] || scalarSenses[i] != expected[i] || inside != (expected[i] == 1))
+		{
+			std::cout << "FAILED (testTorus) => " << p[0] << " " << p[1] << " " << p[2] << " has the sense " << (int)senses[i]
+				<< " (scalar " << (int)scalarSenses[i] << ", single point " << inside << "), expected " << (int)expected[i] << std::endl;
+			failures++;
+		}
+
+		unsigned char quadricSenses[5];
+		double values[5];
+		store.senseQuadrics(p, 0, 5, quadricSenses);
+		store.evaluateQuadrics(p, 0, 5, values);
+		if (quadricSenses[torus] != expected[i] || values[torus] != store.evaluate(torus, p))
+		{
+			std::cout << "FAILED (testTorus) => " << p[0] << " " << p[1] << " " << p[2] << " has the sense " << (int)quadricSenses[torus]
+				<< " among the quadrics, expected " << (int)expected[i] << std::endl;
+			failures++;
+		}
+	}
+}
+
+// ==> randomCoordinate(seed, size)
+// Deterministic pseudo random number in [-size, size) (linear congruential generator)
+//--------------------------------------------------------------------
+static double randomCoordinate(unsigned int& seed, double size)
+{
+	seed = seed*1664525u + 1013904223u;
+	return size*(2.0*(seed >> 8)/16777216.0 - 1.0);
+}
+
+// Accepts the items of which the id is even
+struct EvenTest
+{
+	bool operator()(int id) const { return id % 2 == 0; }
+};
+
+// ==> testHierarchy()
+// The point and ray queries of a hierarchy over random (overlapping) boxes give the items that testing every box gives
+//--------------------------------------------------------------------
+static void testHierarchy()
+{
+	unsigned int seed = 4321;
+	std::vector<Box> boxes;
+	std::vector<int> ids;
+	for (int i = 0; i < 300; i++)
+	{
+		Box box;
+		double p[3] = { randomCoordinate(seed, 20.0), randomCoordinate(seed, 20.0), randomCoordinate(seed, 20.0) };
+		box.grow(p);
+		for (int n = 0; n < 3; n++)
+			p[n] += 2.5 + randomCoordinate(seed, 2.0);
+		box.grow(p);
+		boxes.push_back(box);
+		ids.push_back(1000 + i);
+	}
+	BoundingVolumeHierarchy hierarchy;
+	hierarchy.build(boxes, ids);
+
+	for (int n = 0; n < 2000; n++)
+	{
+		double p[3] = { randomCoordinate(seed, 22.0), randomCoordinate(seed, 22.0), randomCoordinate(seed, 22.0) };
+		bool any = false;
+		for (unsigned int i = 0; i < boxes.size(); i++)
+			any = any || (boxes[i].contains(p) && EvenTest()(ids[i]));
+		int found = hierarchy.findFirst(p, EvenTest());
+		bool valid = (found == -1) ? !any : (EvenTest()(found) && boxes[found - 1000].contains(p));
+		if (!valid)
+		{
+			std::cout << "FAILED (testHierarchy) => " << p[0] << " " << p[1] << " " << p[2] << " finds box " << found
+				<< (any ? ", expected one of the boxes that contain it" : ", expected none") << std::endl;
+			failures++;
+			return;
+		}
+	}
+
+	for (int n = 0; n < 500; n++)
+	{
+		double o[3] = { randomCoordinate(seed, 25.0), randomCoordinate(seed, 25.0), randomCoordinate(seed, 25.0) };
+		double d[3] = { randomCoordinate(seed, 1.0), randomCoordinate(seed, 1.0), randomCoordinate(seed, 1.0) };
+		if (n % 10 == 0)
+			d[n % 3] = 0.0; // parallel to the faces of the boxes
+		double inverse[3] = { 1.0/d[0], 1.0/d[1], 1.0/d[2] };
+		double tMax = 10.0 + randomCoordinate(seed, 10.0);
+		std::vector<int> expected, found;
+		for (unsigned int i = 0; i < boxes.size(); i++)
+			if (boxes[i].isCrossed(o, d, inverse, 0.0, tMax))
+				expected.push_back(ids[i]);
+		hierarchy.findItems(o, d, 0.0, tMax, found);
+		std::sort(found.begin(), found.end());
+		if (found != expected)
+		{
+			std::cout << "FAILED (testHierarchy) => the ray from " << o[0] << " " << o[1] << " " << o[2] << " crosses "
+				<< found.size() << " boxes, expected " << expected.size() << std::endl;
+			failures++;
+			return;
+		}
+	}
+}
+
+// ==> testFindCell()
+// The cells that the hierarchy of a universe finds for points and rays are the ones that testing every cell finds,
+// for overlapping spheres and an outside world without finite bounds
+//--------------------------------------------------------------------
+static void testFindCell()
+{
+	std::ostringstream text;
+	text << "SURFACE&1000&0&SO&30.0\n";
+	for (int i = 0; i < 64; i++)
+		text << "SURFACE&" << i + 1 << "&0&S&" << 3.0*(i % 4) << " " << 3.0*((i/4) % 4) << " " << 3.0*(i/16) << " " << 1.2 + 0.1*(i % 5) << "\n";
+	for (int i = 0; i < 64; i++)
+		text << "CELL&" << i + 1 << "&0&0&0&0&0&-" << i + 1 << "\n";
+	text << "CELL&1000&0&0&0&0&1&1000\n";
+	Geometry geometry;
+	if (!loadGeometry(geometry, text.str().c_str()))
+	{
+		std::cout << "FAILED (testFindCell) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+	const GeometryUniverse* universe = geometry.getUniverse(0);
+
+	unsigned int seed = 8765;
+	for (int n = 0; n < 5000; n++)
+	{
+		double p[3] = { 4.5 + randomCoordinate(seed, 35.0), 4.5 + randomCoordinate(seed, 8.0), 4.5 + randomCoordinate(seed, 8.0) };
+		std::vector<int> expected, found;
+		for (unsigned int i = 0; i < universe->_cells.size(); i++)
+			if (geometry.isInside(universe->_cells[i], p))
+				expected.push_back(universe->_cells[i]);
+		geometry.findAllCells(0, p, found);
+		std::sort(expected.begin(), expected.end());
+		std::sort(found.begin(), found.end());
+		int cell = geometry.findCell(0, p);
+		bool valid = (cell == -1) ? expected.empty() : std::binary_search(expected.begin(), expected.end(), cell);
+		if (found != expected || !valid)
+		{
+			std::cout << "FAILED (testFindCell) => " << p[0] << " " << p[1] << " " << p[2] << " is in " << found.size()
+				<< " cells (first " << cell << "), expected " << expected.size() << std::endl;
+			failures++;
+			return;
+		}
+	}
+
+	// every cell that a ray goes through is a candidate of the ray
+	for (int n = 0; n < 200; n++)
+	{
+		double o[3] = { 4.5 + randomCoordinate(seed, 12.0), 4.5 + randomCoordinate(seed, 12.0), 4.5 + randomCoordinate(seed, 12.0) };
+		double d[3] = { randomCoordinate(seed, 1.0), randomCoordinate(seed, 1.0), randomCoordinate(seed, 1.0) };
+		std::vector<int> candidates;
+		geometry.findCells(0, o, d, 0.0, 20.0, candidates);
+		std::sort(candidates.begin(), candidates.end());
+		for (int step = 0; step <= 400; step++)
+		{
+			double t = 20.0*step/400;
+			double p[3] = { o[0] + t*d[0], o[1] + t*d[1], o[2] + t*d[2] };
+			std::vector<int> cells;
+			geometry.findAllCells(0, p, cells);
+			for (unsigned int i = 0; i < cells.size(); i++)
+				if (!std::binary_search(candidates.begin(), candidates.end(), cells[i]))
+				{
+					std::cout << "FAILED (testFindCell) => the ray from " << o[0] << " " << o[1] << " " << o[2] << " goes through cell "
+						<< geometry.getCell(cells[i])._number << ", which is no candidate" << std::endl;
+					failures++;
+					return;
+				}
+		}
+	}
+}
+
+// Unions, nested complements of groups and cells and the facets of a macrobody
+static const char* COMPILE_GEOMETRY =
+	"SURFACE&1&0&SO&5.0\n"
+	"SURFACE&2&0&PX&0.0\n"
+	"SURFACE&3&0&CZ&2.0\n"
+	"SURFACE&4&0&PZ&1.0\n"
+	"SURFACE&5&0&S&2.0 2.0 0.0 2.5\n"
+	"SURFACE&6&0&RPP&-3.0 3.0 -2.0 2.0 -4.0 4.0\n"
+	"SURFACE&9&0&PY&-1.0\n"
+	"CELL&1&0&0&0&0&0&-1 2 -4\n"
+	"CELL&2&0&0&0&0&0&-3 : -5 9\n"
+	"CELL&3&0&0&0&0&0&#(-1 2) -6 (4 : -3)\n"
+	"CELL&4&0&0&0&0&0&#1 #2 -6.1 6.3 : -5 #3\n"
+	"CELL&5&0&0&0&0&0&(-6 : -1) #(2 : #(-3 4))\n"
+	"CELL&6&0&0&0&0&0&#4 #5 -1 : -6.2 -6.5 : +9 -3 #(5 : -4)\n"
+	"CELL&7&0&0&0&0&1&1\n";
+
+// ==> testCompiledCode()
+// Running the compiled code of a cell gives the same as walking its node tree, for random points
+//--------------------------------------------------------------------
+static void testCompiledCode()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, COMPILE_GEOMETRY))
+	{
+		std::cout << "FAILED (testCompiledCode) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+
+	unsigned int seed = 2468;
+	const int points = 20000;
+	for (int cell = 0; cell < geometry.getCellCount(); cell++)
+	{
+		int inside = 0;
+		for (int n = 0; n < points; n++)
+		{
+			double p[3] = { randomCoordinate(seed, 7.0), randomCoordinate(seed, 7.0), randomCoordinate(seed, 7.0) };
+			bool compiled = geometry.isInside(cell, p);
+			if (compiled != geometry.isInsideTree(cell, p))
+			{
+				std::cout << "FAILED (testCompiledCode) => " << p[0] << " " << p[1] << " " << p[2] << " is " << (compiled ? "inside" : "outside")
+					<< " cell " << geometry.getCell(cell)._number << " by its code, not by its node tree" << std::endl;
+				failures++;
+				return;
+			}
+			inside += compiled;
+		}
+		// both results must occur, else the cell checks nothing
+		if (inside == 0 || inside == points)
+		{
+			std::cout << "FAILED (testCompiledCode) => cell " << geometry.getCell(cell)._number << " has " << inside << " of " << points << " points" << std::endl;
+			failures++;
+		}
+	}
+}
+
+// ==> testVoxelCache()
+// A saved grid loads with the same voxels, the key of another size, other bounds or another geometry file doesn't
+// load it
+//--------------------------------------------------------------------
+static void testVoxelCache()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, TRCL_GEOMETRY))
+	{
+		std::cout << "FAILED (testVoxelCache) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+
+	Box bounds;
+	double corners[2][3] = { { -8.0, -6.0, -2.0 }, { 26.0, 6.0, 2.0 } };
+	bounds.grow(corners[0]);
+	bounds.grow(corners[1]);
+	int size[3];
+	VoxelGrid::getSize(bounds, 40, size);
+	QString key = VoxelGrid::getKey(&geometry, bounds, size);
+	QString fileName = QDir::tempPath() + "/GeometryTest_voxels";
+
+	VoxelGrid grid;
+	if (!grid.build(&geometry, bounds, size, 2) || !grid.save(fileName, key))
+	{
+		std::cout << "FAILED (testVoxelCache) => couldn't build and save the grid" << std::endl;
+		failures++;
+		return;
+	}
+
+	VoxelGrid loaded;
+	if (!loaded.load(fileName, key))
+	{
+		std::cout << "FAILED (testVoxelCache) => the saved grid doesn't load" << std::endl;
+		failures++;
+	}
+	else
+	{
+		bool same = true;
+		for (int i = 0; i < 3; i++)
+			same = same && loaded.getSize(i) == size[i] && loaded.getBounds()._min[i] == bounds._min[i] && loaded.getBounds()._max[i] == bounds._max[i];
+		int voxels = size[0]*size[1]*size[2];
+		for (int n = 0; n < voxels && same; n++)
+			same = loaded.getCell(n) == grid.getCell(n) && loaded.getMaterial(n) == grid.getMaterial(n) && loaded.getLabel(n) == grid.getLabel(n);
+		if (!same)
+		{
+			std::cout << "FAILED (testVoxelCache) => the loaded grid differs from the saved one" << std::endl;
+			failures++;
+		}
+	}
+
+	// the same file gives the same key
+	Geometry again;
+	loadGeometry(again, TRCL_GEOMETRY);
+	if (VoxelGrid::getKey(&again, bounds, size) != key)
+	{
+		std::cout << "FAILED (testVoxelCache) => the same geometry file has another key" << std::endl;
+		failures++;
+	}
+
+	// another size, other bounds and another geometry file
+	int otherSize[3];
+	VoxelGrid::getSize(bounds, 20, otherSize);
+	Box lowerBounds = bounds, upperBounds = bounds;
+	lowerBounds._min[0] -= 1.0;
+	upperBounds._max[2] += 1.0;
+	std::string otherText = TRCL_GEOMETRY;
+	otherText.replace(otherText.find("SO&5.0"), 6, "SO&5.5");
+	Geometry other;
+	loadGeometry(other, otherText.c_str());
+	QString keys[4] = { VoxelGrid::getKey(&geometry, bounds, otherSize), VoxelGrid::getKey(&geometry, lowerBounds, size),
+						VoxelGrid::getKey(&geometry, upperBounds, size), VoxelGrid::getKey(&other, bounds, size) };
+	const char* changes[4] = { "size", "lower bound", "upper bound", "geometry file" };
+	for (int i = 0; i < 4; i++)
+		if (keys[i] == key || loaded.load(fileName, keys[i]) || !loaded.isEmpty())
+		{
+			std::cout << "FAILED (testVoxelCache) => the grid loads for another " << changes[i] << std::endl;
+			failures++;
+		}
+	QFile::remove(fileName);
+}
+
+// ==> testOctreeSkipping()
+// Skipping the empty and uniform nodes of the octree gives the image of marching every voxel (up to the rounding
+// of blending a node at once and of stopping at a low transmittance), on a grid of which the size is no power of two
+//--------------------------------------------------------------------
+static void testOctreeSkipping()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, TRCL_GEOMETRY))
+	{
+		std::cout << "FAILED (testOctreeSkipping) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+	Box bounds;
+	double corners[2][3] = { { -8.0, -8.0, -3.0 }, { 26.0, 8.0, 3.0 } };
+	bounds.grow(corners[0]);
+	bounds.grow(corners[1]);
+	int size[3];
+	VoxelGrid::getSize(bounds, 80, size);
+	VoxelGrid grid;
+	grid.build(&geometry, bounds, size, 2);
+
+	// material 2 (around the sphere of cell 11) is not drawn
+	std::map<int, Material*> materials;
+	int numbers[5] = { 1, 2, 6, 7, 8 };
+	float alphas[5] = { 1.0f, 0.0f, 0.6f, 0.3f, 0.2f };
+	for (int i = 0; i < 5; i++)
+	{
+		materials[numbers[i]] = new Material(numbers[i]);
+		materials[numbers[i]]->setColor(QColor(50*i, 255 - 40*i, 120));
+		materials[numbers[i]]->setAlpha(alphas[i]);
+	}
+	Camera camera;
+	camera.onCameraPositionChanged(12.0f, 15.0f, -27.0f);
+	camera.onCameraStrafeChanged(9.0f, 0.0f, 0.0f);
+
+	VolumeRenderer renderer(&geometry, &grid);
+	renderer.setCamera(&camera);
+	renderer.setMaterials(materials);
+	renderer.setThreads(2);
+	QImage skipped = renderer.render(160, 120);
+	renderer.setSkipping(false);
+	QImage marched = renderer.render(160, 120);
+	for (int i = 0; i < 5; i++)
+		delete materials[numbers[i]];
+
+	int drawn = 0;
+	QRgb background = skipped.pixel(0, 0);
+	for (int y = 0; y < 120; y++)
+		for (int x = 0; x < 160; x++)
+		{
+			QRgb a = skipped.pixel(x, y), b = marched.pixel(x, y);
+			if (std::abs(qRed(a) - qRed(b)) > 2 || std::abs(qGreen(a) - qGreen(b)) > 2 || std::abs(qBlue(a) - qBlue(b)) > 2)
+			{
+				std::cout << "FAILED (testOctreeSkipping) => pixel " << x << " " << y << " is " << qRed(a) << " " << qGreen(a) << " " << qBlue(a)
+					<< " with skipping, " << qRed(b) << " " << qGreen(b) << " " << qBlue(b) << " without" << std::endl;
+				failures++;
+				return;
+			}
+			drawn += (b != background);
+		}
+	if (drawn < 160*120/10)
+	{
+		std::cout << "FAILED (testOctreeSkipping) => only " << drawn << " pixels show the grid" << std::endl;
+		failures++;
+	}
+}
+
+// Cells 1 and 2 overlap where the spheres 2 and 3 do, universe 0 has a hole for x > 8 and universe 1 (that fills
+// cell 1) has a hole between the spheres 5 and 6
+static const char* CHECK_GEOMETRY =
+	"SURFACE&2&0&SO&3.0\n"
+	"SURFACE&3&0&S&4.0 0.0 0.0 3.0\n"
+	"SURFACE&4&0&PX&8.0\n"
+	"SURFACE&5&0&SO&1.0\n"
+	"SURFACE&6&0&SO&2.0\n"
+	"SURFACE&10&0&SO&10.0\n"
+	"CELL&1&0&0&1&0&0&-2\n"
+	"CELL&2&0&0&0&0&0&-3\n"
+	"CELL&3&0&0&0&0&0&-10 2 3 -4\n"
+	"CELL&4&0&0&0&0&1&10\n"
+	"CELL&11&0&1&0&0&0&-5\n"
+	"CELL&12&0&1&0&0&0&5 -6\n";
+
+// ==> checkErrorPoints(error, expected)
+// Every point of the error must be where the error is expected (see testChecker)
+//--------------------------------------------------------------------
+static bool checkErrorPoints(const GeometryError& error, int expected)
+{
+	for (unsigned int i = 0; i < error._points.size(); i += 3)
+	{
+		const double* p = &error._points[i];
+		double r = std::sqrt(p[0]*p[0] + p[1]*p[1] + p[2]*p[2]);
+		double s = std::sqrt((p[0] - 4.0)*(p[0] - 4.0) + p[1]*p[1] + p[2]*p[2]);
+		bool valid = (expected == 0 && r < 3.0 && s < 3.0) || (expected == 1 && p[0] > 8.0 && r < 10.0)
+					|| (expected == 2 && r > 2.0 && r < 3.0 && s > 3.0);
+		if (!valid)
+		{
+			std::cout << "FAILED (testChecker) => error " << expected << " at " << p[0] << " " << p[1] << " " << p[2] << std::endl;
+			failures++;
+			return false;
+		}
+	}
+	return !error._points.empty();
+}
+
+// ==> testChecker()
+// The overlap and the holes of CHECK_GEOMETRY are found (at points where they are) and nothing else, the same with
+// one or more threads, and a valid geometry has no errors
+//--------------------------------------------------------------------
+static void testChecker()
+{
+	Geometry geometry;
+	if (!loadGeometry(geometry, CHECK_GEOMETRY))
+	{
+		std::cout << "FAILED (testChecker) => couldn't load the geometry" << std::endl;
+		failures++;
+		return;
+	}
+	Box bounds;
+	double corners[2][3] = { { -11.0, -11.0, -11.0 }, { 11.0, 11.0, 11.0 } };
+	bounds.grow(corners[0]);
+	bounds.grow(corners[1]);
+	int size[3] = { 30, 30, 30 };
+
+	GeometryChecker checker(&geometry);
+	checker.check(bounds, size, 3);
+	const std::vector<GeometryError>& errors = checker.getErrors();
+	bool found[3] = { false, false, false };
+	for (unsigned int i = 0; i < errors.size(); i++)
+	{
+		const GeometryError& error = errors[i];
+		if (error._universe == 0 && error._cells.size() == 2 && error._cells[0] == 1 && error._cells[1] == 2)
+			found[0] = checkErrorPoints(error, 0);
+		else if (error._universe == 0 && error.isHole())
+			found[1] = checkErrorPoints(error, 1);
+		else if (error._universe == 1 && error.isHole())
+			found[2] = checkErrorPoints(error, 2);
+		else
+		{
+			std::cout << "FAILED (testChecker) => unexpected error of " << error._cells.size() << " cells in universe " << error._universe << std::endl;
+			failures++;
+		}
+	}
+	const char* names[3] = { "overlap of cells 1 and 2", "hole in universe 0", "hole in universe 1" };
+	for (int i = 0; i < 3; i++)
+		if (!found[i])
+		{
+			std::cout << "FAILED (testChecker) => the " << names[i] << " is not found" << std::endl;
+			failures++;
+		}
+	if (checker.getSampleCount() != 2*size[0]*size[1]*size[2])
+	{
+		std::cout << "FAILED (testChecker) => " << checker.getSampleCount() << " points checked" << std::endl;
+		failures++;
+	}
+
+	// one thread finds the same errors with the same first points
+	GeometryChecker single(&geometry);
+	single.check(bounds, size, 1);
+	bool same = single.getErrors().size() == errors.size();
+	for (unsigned int i = 0; same && i < errors.size(); i++)
+		same = single.getErrors()[i]._cells == errors[i]._cells && single.getErrors()[i]._samples == errors[i]._samples
+				&& single.getErrors()[i]._points == errors[i]._points;
+	if (!same)
+	{
+		std::cout << "FAILED (testChecker) => one thread finds other errors" << std::endl;
+		failures++;
+	}
+
+	// a valid geometry, with filled cells and a lattice
+	Geometry valid;
+	loadGeometry(valid, TRCL_GEOMETRY);
+	double validCorners[2][3] = { { -10.0, -10.0, -10.0 }, { 30.0, 10.0, 10.0 } };
+	Box validBounds;
+	validBounds.grow(validCorners[0]);
+	validBounds.grow(validCorners[1]);
+	GeometryChecker validChecker(&valid);
+	validChecker.check(validBounds, size, 3);
+	if (!validChecker.getErrors().empty())
+	{
+		std::cout << "FAILED (testChecker) => " << validChecker.getErrors().size() << " errors in a valid geometry (first in universe "
+			<< validChecker.getErrors()[0]._universe << ")" << std::endl;
+		failures++;
+	}
+}
+
+int main()
+{
+	testTrcl();
+	testTrCards();
+	testBatch();
+	testLabels();
+	testKernels();
+	testTorus();
+	testHierarchy();
+	testFindCell();
+	testCompiledCode();
+	testVoxelCache();
+	testOctreeSkipping();
+	testChecker();
+	if (failures == 0)
+		std::cout << "All checks passed" << std::endl;
+	return failures;
+}
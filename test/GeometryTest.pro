@@ -0,0 +1,30 @@
+CONFIG += qt console
+CONFIG -= app_bundle
+
+TEMPLATE = app
+TARGET = GeometryTest
+
+INCLUDEPATH += ../source
+DEPENDPATH += ../source
+
+
+# Input
+HEADERS += ../source/BoundingVolumeHierarchy.h \
+	   ../source/Camera.h \
+	   ../source/Cell.h \
+	   ../source/Geometry.h \
+	   ../source/GeometryChecker.h \
+	   ../source/Material.h \
+	   ../source/SurfaceStore.h \
+	   ../source/SurfaceStoreKernels.h \
+	   ../source/Transformation.h \
+	   ../source/VolumeRenderer.h \
+	   ../source/VoxelGrid.h
+SOURCES += GeometryTest.cpp \
+	   ../source/BoundingVolumeHierarchy.cpp \
+	   ../source/Geometry.cpp \
+	   ../source/GeometryChecker.cpp \
+	   ../source/SurfaceStore.cpp \
+	   ../source/Transformation.cpp \
+	   ../source/VolumeRenderer.cpp \
+	   ../source/VoxelGrid.cpp